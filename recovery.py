@@ -1,10 +1,16 @@
 #!/usr/bin/env python
 # vim: ai ts=4 sts=4 et sw=4
 
+import argparse
+import array
+import errno
+import mmap
 import os
 import sys
 import struct
+import threading
 import time
+import zlib
 
 root_dir = os.path.abspath(os.path.dirname(__file__))
 pyusb_dir = os.path.join(root_dir, 'pyusb')
@@ -18,12 +24,161 @@ if sys.platform == 'win32':
 import usb.core
 import usb.util
 
-LOAD_COMMAND = 0
-RUN_COMMAND  = 1
+try:
+    import lz4.block as lz4_block
+except ImportError:
+    lz4_block = None
+
+VENDOR_ID  = 0x0000
+PRODUCT_ID = 0x7f20
+
+LOAD_COMMAND         = 0
+RUN_COMMAND          = 1
+NAND_PROGRAM_COMMAND = 2
+NAND_STATUS_COMMAND  = 3
+NAND_DUMP_COMMAND    = 4
+LOAD_CRC_COMMAND     = 5
+LOAD_LZ4_COMMAND     = 6
+LOAD_SPARSE_COMMAND  = 7
+LOAD_SG_COMMAND      = 8
+STATS_COMMAND        = 9
+BULK_COMMAND         = 10
+
+LOAD_DEPTH   = 4            # LOAD requests the device can hold queued
+LOAD_SEGMENT = 1024*1024    # bytes per LOAD, a multiple of wMaxPacketSize
+LOAD_SG_MAX  = 32           # segments per LOAD_SG
+WRITE_SIZE   = 1024*1024    # most bytes handed to pyusb per bulk write
+
+BULK_HEADER  = '<4sIIBBH'   # magic, tag, payload length, command, status
+BULK_DEPTH   = 4            # status frames the device can hold unread
+
+LZ4_STAGE_SIZE = 16*1024    # device block buffer, size word included
+LZ4_BLOCK_MAX  = 64*1024    # largest input tried per compressed block
+LZ4_STORED     = 0x80000000
+
+SPARSE_RAW        = 0xCAC1
+SPARSE_FILL       = 0xCAC2
+SPARSE_DONT_CARE  = 0xCAC3
+SPARSE_CRC32      = 0xCAC4  # Android images only, not sent
+SPARSE_MAX_CHUNKS = 42      # chunk headers per transfer
+SPARSE_BLOCK      = 4096    # granularity fill runs are found at
+
+# device statistics, in the order of enum stats_counter and stats_hist
+STATS_COUNTERS = ('resets', 'setups', 'out_packets', 'out_bytes',
+        'in_packets', 'in_bytes', 'out_no_req', 'stalls', 'aborts',
+        'bch_decodes', 'bch_corrected', 'bch_failed')
+STATS_HISTS = ('fifo_read', 'fifo_write', 'bch_decode')
+
+def view(data, offset=0, size=None):
+    # a window on a string or mmap that shares its memory, so images of
+    # any size are sliced without copies
+    if size is None:
+        size = len(data) - offset
+    return buffer(data, offset, size)
+
+def open_image(path):
+    # the file mapped read-only, which pages in as it is sent; short
+    # files, and those that cannot be mapped, are read
+    with open(path, 'rb') as f:
+        try:
+            return mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        except (ValueError, mmap.error):
+            return f.read()
+
+def sparse_chunks(data, block=SPARSE_BLOCK):
+    # (type, length, payload) runs of data; blocks that repeat one 32-bit
+    # word become FILL chunks with that word as payload
+    runs = []
+    for offset in range(0, len(data), block):
+        chunk = data[offset:offset + block]
+        word = (chunk[:4] * 4)[:4]
+        if (word * (len(chunk) // 4 + 1))[:len(chunk)] == chunk:
+            kind, fill = SPARSE_FILL, struct.unpack('<I', word)[0]
+        else:
+            kind, fill = SPARSE_RAW, None
+        if runs and runs[-1][0] == kind and runs[-1][3] == fill:
+            runs[-1][2] += len(chunk)
+        else:
+            runs.append([kind, offset, len(chunk), fill])
+    return [(kind, size, view(data, offset, size) if kind == SPARSE_RAW
+            else fill) for kind, offset, size, fill in runs]
+
+def android_sparse_chunks(image):
+    # chunks of an Android sparse image, as made by img2simg
+    (magic, major, minor, file_hdr_sz, chunk_hdr_sz, blk_sz, total_blks,
+            total_chunks, checksum) = struct.unpack('<IHHHHIIII', image[:28])
+    if magic != 0xed26ff3a or major != 1:
+        raise ValueError('not an Android sparse image')
+    chunks = []
+    offset = file_hdr_sz
+    for i in range(total_chunks):
+        kind, reserved, blocks, total_sz = struct.unpack('<HHII',
+                image[offset:offset + 12])
+        body = view(image, offset + chunk_hdr_sz, total_sz - chunk_hdr_sz)
+        offset += total_sz
+        if kind == SPARSE_RAW:
+            chunks.append((kind, blocks * blk_sz, body))
+        elif kind == SPARSE_FILL:
+            chunks.append((kind, blocks * blk_sz,
+                    struct.unpack('<I', body[:4])[0]))
+        elif kind == SPARSE_DONT_CARE:
+            chunks.append((kind, blocks * blk_sz, None))
+        elif kind != SPARSE_CRC32:
+            raise ValueError('unknown sparse chunk type %04x' % kind)
+    return chunks
+
+# histogram buckets are log2 steps of 128 ns
+STATS_UNIT_NS = 128
+
+def _time_label(ns):
+    if ns < 1000:
+        return '%d ns' % ns
+    if ns < 1000000:
+        return '%.1f us' % (ns / 1e3)
+    return '%.2f ms' % (ns / 1e6)
+
+def _bucket_label(n, buckets):
+    if n == 0:
+        return '< %s' % _time_label(STATS_UNIT_NS)
+    if n == buckets - 1:
+        return '>= %s' % _time_label(STATS_UNIT_NS << (n - 1))
+    return '%s-%s' % (_time_label(STATS_UNIT_NS << (n - 1)),
+            _time_label(STATS_UNIT_NS << n))
+
+def print_stats(before, after, out=sys.stdout):
+    # differences between two Recovery.stats() snapshots, with rates
+    # from the device's own microsecond clock
+    us = (after['now_us'] - before['now_us']) & 0xffffffff
+    secs = us / 1e6 if us else 1e-6
+    out.write('device statistics over %.3f s\n' % (us / 1e6))
+    for name in STATS_COUNTERS:
+        n = (after[name] - before[name]) & 0xffffffff
+        out.write('  %-14s %12d %14.1f/s\n' % (name, n, n / secs))
+    for name in STATS_HISTS:
+        hist = [(a - b) & 0xffffffff
+                for a, b in zip(after[name], before[name])]
+        total = sum(hist)
+        if not total:
+            continue
+        out.write('  %s, %d samples\n' % (name, total))
+        for n, count in enumerate(hist):
+            if count:
+                out.write('    %-12s %10d %5.1f%%\n' % (
+                        _bucket_label(n, len(hist)), count,
+                        100.0 * count / total))
 
 class Recovery(object):
-    def __init__(self, device):
+    def __init__(self, device, depth=LOAD_DEPTH):
+        # depth: how many of the device's LOAD slots to use, 2 up to
+        # LOAD_DEPTH; fewer keep less of an image in flight
+        if not 2 <= depth <= LOAD_DEPTH:
+            raise ValueError('depth must be 2..%d' % LOAD_DEPTH)
         self.device = device
+        self.depth = depth
+        self.bulk = False
+        self.tag = 0
+        self.outstanding = []   # tags sent, in order, status not yet read
+        self.results = {}       # tag: payload, read ahead of its turn
 
         self.device.set_configuration()
         config_descriptor = self.device.get_active_configuration()
@@ -45,36 +200,534 @@ class Recovery(object):
                 usb.util.ENDPOINT_OUT
         )
 
-    def cmd_send(self, command, data=None):
-        self.device.ctrl_transfer(0x40, 0x40, command, 0, data)
+        self.data_in = usb.util.find_descriptor(
+            interface_descriptor,
+            custom_match = \
+            lambda e:
+                usb.util.endpoint_direction(e.bEndpointAddress) == \
+                usb.util.ENDPOINT_IN
+        )
+
+    def cmd_send(self, command, data=None, index=0):
+        # commands with a payload go as frames once bulk mode is on
+        if self.bulk and data is not None:
+            self.bulk_command(command, data)
+            return
+        self.device.ctrl_transfer(0x40, 0x40, command, index, data)
 
     def cmd_recv(self, command, count=65535):
         assert(count > 0)
-        self.device.ctrl_transfer(0xC0, 0x40, command, 0, count)
+        if self.bulk:
+            result = array.array('B')
+            result.fromstring(self.bulk_command(command)[:count])
+            return result
+        return self.device.ctrl_transfer(0xC0, 0x40, command, 0, count)
+
+    def bulk_enable(self, on=True):
+        # Commands become frames on the bulk endpoints: a header and the
+        # payload on EP1, answered in order by a status frame on EP2.
+        # Up to BULK_DEPTH may be in flight, so small commands no longer
+        # wait out a control transfer each.
+        if self.bulk:
+            self.bulk_wait()
+        self.device.ctrl_transfer(0x40, 0x40, BULK_COMMAND, int(on), None)
+        self.bulk = on
 
-    def load(self, data, addr=0):
-        length = len(data)
-        self.cmd_send(LOAD_COMMAND, data=struct.pack('<II', addr, length))
-        chunk_size = 64*1024
+    def bulk_submit(self, command, data=''):
+        # sends a frame without waiting for its status; returns its tag
+        while len(self.outstanding) >= BULK_DEPTH:
+            self._bulk_read()
+        tag = self.tag
+        self.tag = (self.tag + 1) & 0xffffffff
+        frame = struct.pack(BULK_HEADER, 'RCMD', tag, len(data), command,
+                0, 0) + str(data)
+        # a frame of whole packets would not end the transfer
+        if len(frame) % self.data_out.wMaxPacketSize == 0:
+            frame += '\0'
+        self.outstanding.append(tag)
+        try:
+            self.write(frame)
+        except usb.core.USBError:
+            # a failed stream leaves EP1 stalled, frames follow the clear
+            self.device.clear_halt(self.data_out.bEndpointAddress)
+            self.write(frame)
+        return tag
+
+    def _bulk_read(self):
+        frame = self.data_in.read(struct.calcsize(BULK_HEADER) + 256)
+        frame = frame.tostring()
+        magic, tag, length, command, status, _ = \
+                struct.unpack_from(BULK_HEADER, frame)
+        if magic != 'RSTS' or not self.outstanding or \
+                tag != self.outstanding[0]:
+            raise IOError('bad status frame')
+        self.outstanding.pop(0)
+        self.results[tag] = (command, status,
+                frame[struct.calcsize(BULK_HEADER):][:length])
+
+    def bulk_result(self, tag):
+        # the reply payload of a submitted frame
+        while tag not in self.results:
+            self._bulk_read()
+        command, status, data = self.results.pop(tag)
+        if status:
+            raise IOError('command %d failed, status %d' % (command, status))
+        return data
+
+    def bulk_command(self, command, data=''):
+        return self.bulk_result(self.bulk_submit(command, data))
+
+    def bulk_wait(self):
+        # reads every status still in flight, raising the first failure
+        for tag in self.results.keys() + self.outstanding:
+            self.bulk_result(tag)
+
+    def write(self, data):
+        # one bulk transfer of data, a string, mmap or view.  pyusb wants
+        # an array, the only copy made, so it gets WRITE_SIZE at a time.
         written = 0
-        while written < length:
-            chunk = data[written:written + chunk_size]
+        while written < len(data):
+            chunk = array.array('B')
+            chunk.fromstring(view(data, written,
+                    min(WRITE_SIZE, len(data) - written)))
             written += self.data_out.write(chunk)
 
+    def load(self, data, addr=0, segment_size=LOAD_SEGMENT, verify=True):
+        segments = [(addr + offset, view(data, offset,
+                min(segment_size, len(data) - offset)))
+                for offset in range(0, len(data), segment_size)]
+        # start from a clean sum
+        self._load_idle()
+        self._stream(segments)
+        if verify:
+            self.load_verify(zlib.crc32(data) & 0xffffffff, len(data))
+
+    def load_lz4(self, data, addr=0, verify=True):
+        # Sends data as LZ4 blocks, one bulk transfer each; the device
+        # decodes a block into place while the next one arrives.  Without
+        # the lz4 module the blocks go out stored.
+        if not data:
+            # the device rejects an empty LZ4 load
+            return self.load(data, addr, verify=verify)
+        self._load_idle()
+        self.cmd_send(LOAD_LZ4_COMMAND,
+                data=struct.pack('<II', addr, len(data)))
+        try:
+            for block in self._lz4_blocks(data):
+                self.data_out.write(block)
+        except usb.core.USBError:
+            # EP1 is stalled on a bad block, the CRC check reports it
+            self.device.clear_halt(self.data_out.bEndpointAddress)
+        if verify:
+            self.load_verify(zlib.crc32(data) & 0xffffffff, len(data))
+
+    def _lz4_blocks(self, data):
+        limit = LZ4_STAGE_SIZE - 4
+        mps = self.data_out.wMaxPacketSize
+        offset = 0
+        while offset < len(data):
+            # the largest input whose block fits the device buffer
+            size = min(LZ4_BLOCK_MAX, len(data) - offset)
+            while True:
+                chunk = data[offset:offset + size]
+                if lz4_block:
+                    packed = lz4_block.compress(chunk, store_size=False)
+                    if len(packed) < len(chunk) and len(packed) <= limit:
+                        block = struct.pack('<I', len(packed)) + packed
+                        break
+                if size <= limit:
+                    block = struct.pack('<I', size | LZ4_STORED) + chunk
+                    break
+                size //= 2
+            # the short packet ends the block, unless it fills the buffer
+            if len(block) % mps == 0 and len(block) != LZ4_STAGE_SIZE:
+                block += '\0'
+            offset += size
+            yield block
+
+    def load_sparse(self, data, addr=0, verify=True):
+        self.load_chunks(sparse_chunks(data), addr, verify)
+
+    def load_chunks(self, chunks, addr=0, verify=True):
+        # Only RAW chunks cross the bus; FILL chunks are expanded by the
+        # device and DONT_CARE chunks leave its memory as it is.  Chunk
+        # headers go in batches ended by a RAW chunk, whose data follows
+        # as a transfer of its own.  RAW payloads may be views.
+        length = sum(size for kind, size, payload in chunks)
+        if not length:
+            # the device rejects an empty sparse load
+            return self.load('', addr, verify=verify)
+        crc = 0
+        raw = 0
+        for kind, size, payload in chunks:
+            if kind == SPARSE_RAW:
+                crc = zlib.crc32(payload, crc)
+                raw += size
+        self._load_idle()
+        self.cmd_send(LOAD_SPARSE_COMMAND,
+                data=struct.pack('<II', addr, length))
+        mps = self.data_out.wMaxPacketSize
+        try:
+            batch = ''
+            for i, (kind, size, payload) in enumerate(chunks):
+                fill = payload if kind == SPARSE_FILL else 0
+                batch += struct.pack('<HHII', kind, 0, size, fill)
+                if kind != SPARSE_RAW and i != len(chunks) - 1 and \
+                        len(batch) < SPARSE_MAX_CHUNKS * 12:
+                    continue
+                # the short packet ends the batch, unless it fills it
+                if len(batch) % mps == 0 and \
+                        len(batch) != SPARSE_MAX_CHUNKS * 12:
+                    batch += '\0'
+                self.data_out.write(batch)
+                batch = ''
+                if kind == SPARSE_RAW:
+                    self.write(payload)
+        except usb.core.USBError:
+            # EP1 is stalled on a bad chunk, the CRC check reports it
+            self.device.clear_halt(self.data_out.bEndpointAddress)
+        if verify:
+            self.load_verify(crc & 0xffffffff, raw)
+
+    def load_sg(self, segments, verify=True):
+        # (addr, data) segments; each LOAD_SG sends up to LOAD_SG_MAX
+        # destinations, then their data as one bulk stream with every
+        # segment padded to whole packets.
+        segments = [(addr, data) for addr, data in segments if data]
+        mps = self.data_out.wMaxPacketSize
+        for i in range(0, len(segments), LOAD_SG_MAX):
+            group = segments[i:i + LOAD_SG_MAX]
+            self._load_idle()
+            self.cmd_send(LOAD_SG_COMMAND, data=''.join(
+                    struct.pack('<II', addr, len(data))
+                    for addr, data in group))
+            # whole packets go out in place, only each segment's padded
+            # last packet is built as a string
+            for addr, data in group:
+                whole = len(data) - len(data) % mps
+                self.write(view(data, 0, whole))
+                if whole < len(data):
+                    self.write(str(view(data, whole)) +
+                            '\0' * (whole + mps - len(data)))
+            if verify:
+                crc = 0
+                for addr, data in group:
+                    crc = zlib.crc32(data, crc)
+                self.load_verify(crc & 0xffffffff,
+                        sum(len(data) for addr, data in group))
+
+    def load_elf(self, image, verify=True):
+        # Loads the PT_LOAD segments of a 32-bit little endian ELF at
+        # their physical addresses and zeroes the part of each that is
+        # not in the file (.bss).  Returns the entry point for run().
+        if image[:4] != '\x7fELF' or image[4:6] != '\x01\x01':
+            raise ValueError('not a 32-bit little endian ELF')
+        entry, phoff = struct.unpack('<II', image[24:32])
+        phentsize, phnum = struct.unpack('<HH', image[42:46])
+        segments = []
+        for i in range(phnum):
+            ph = phoff + i * phentsize
+            kind, offset, vaddr, paddr, filesz, memsz = \
+                    struct.unpack('<IIIIII', image[ph:ph + 24])
+            if kind != 1:
+                continue
+            segments.append((paddr, view(image, offset, filesz)))
+            if memsz > filesz:
+                self.load_chunks([(SPARSE_FILL, memsz - filesz, 0)],
+                        paddr + filesz, verify)
+        self.load_sg(segments, verify)
+        return entry
+
+    def load_crc(self):
+        # (crc, length, pending); the sum restarts once read idle
+        return struct.unpack('<III',
+                self.cmd_recv(LOAD_CRC_COMMAND, 12).tostring())
+
+    def _load_idle(self):
+        # waits out a load in progress; the last write can return before
+        # the device retires it.  Reading the sum idle restarts it.
+        for i in range(1000):
+            crc, length, pending = self.load_crc()
+            if not pending:
+                return crc, length
+            time.sleep(0.001)
+        raise IOError('device still busy loading')
+
+    def load_verify(self, expected, expected_length):
+        crc, length = self._load_idle()
+        if length != expected_length or crc != expected:
+            raise IOError('LOAD CRC %08x over %d bytes, expected %08x '
+                    'over %d' % (crc, length, expected, expected_length))
+
+    def _stream(self, segments):
+        # The device keeps up to self.depth LOAD requests queued on EP1,
+        # so the next segment's LOAD is sent while the previous one is
+        # still streaming.  Each segment goes out as one large bulk write,
+        # which libusb splits into several URBs submitted together.  A
+        # write can return just before the device retires the request, so
+        # one slot is held back.
+        #
+        # pyusb has no asynchronous API, so a writer thread stands in for
+        # one: writes block with the GIL released, LOADs go out from this
+        # thread meanwhile, and the only gap on the bus is the copy of the
+        # next segment into an array, under 0.5% of its time on the wire.
+        if self.bulk:
+            # frames share EP1 with the data, so each LOAD goes right
+            # ahead of its segment; statuses are read as slots run out
+            tags = [self._stream_bulk(addr, chunk)
+                    for addr, chunk in segments]
+            for tag in tags:
+                self.bulk_result(tag)
+            return
+
+        armed = threading.Semaphore(0)
+        slots = threading.Semaphore(self.depth - 1)
+        errors = []
+
+        def writer():
+            try:
+                for addr, chunk in segments:
+                    armed.acquire()
+                    if errors:
+                        return
+                    self.write(chunk)
+                    slots.release()
+            except Exception as e:
+                errors.append(e)
+                slots.release()
+
+        thread = threading.Thread(target=writer)
+        thread.start()
+        try:
+            for addr, chunk in segments:
+                slots.acquire()
+                if errors:
+                    break
+                self.cmd_send(LOAD_COMMAND,
+                        data=struct.pack('<II', addr, len(chunk)))
+                armed.release()
+        except Exception as e:
+            errors.append(e)
+            armed.release()
+        thread.join()
+        if errors:
+            raise errors[0]
+
+    def _stream_bulk(self, addr, chunk):
+        tag = self.bulk_submit(LOAD_COMMAND, struct.pack('<II', addr,
+                len(chunk)))
+        self.write(chunk)
+        return tag
+
+    def nand_program(self, data, page=0, page_size=2048):
+        # Pages stream straight into NAND; the device computes the ECC
+        # and erases each block as programming enters it, so page must
+        # be block aligned.  A factory bad block fails at its first page.
+        pages = (len(data) + page_size - 1) // page_size
+        whole = len(data) - len(data) % page_size
+        self.cmd_send(NAND_PROGRAM_COMMAND,
+                data=struct.pack('<II', page, pages))
+        try:
+            self.write(view(data, 0, whole))
+            if whole < len(data):
+                self.write(str(view(data, whole)) +
+                        '\xff' * (whole + page_size - len(data)))
+        except usb.core.USBError as e:
+            # EP1 is stalled when a page fails, the status says which
+            if e.errno != errno.EPIPE:
+                raise
+        # a page takes well under 10 ms to program, an erase included
+        for i in range(1000 + 10 * pages):
+            remaining, failed, corrected = self.nand_status()
+            if failed != 0xffffffff:
+                # frames find EP1 stalled and clear it themselves
+                if not self.bulk:
+                    self.device.clear_halt(
+                            self.data_out.bEndpointAddress)
+                raise IOError('NAND program failed at page %d' % failed)
+            if not remaining:
+                return
+            time.sleep(0.001)
+        raise IOError('NAND program stuck with %d pages left' % remaining)
+
+    def nand_dump(self, page, count, page_size=2048):
+        # Pages come back corrected; returns the data and the number of
+        # bit flips fixed.  Uncorrectable pages are returned as read.
+        self.cmd_send(NAND_DUMP_COMMAND, data=struct.pack('<II', page, count))
+        length = count * page_size
+        data = self.data_in.read(length, timeout=max(1000, count))
+        if len(data) != length:
+            raise IOError('NAND dump short by %d bytes' % (length - len(data)))
+        remaining, failed, corrected = self.nand_status()
+        if failed != 0xffffffff:
+            raise IOError('uncorrectable ECC error at page %d' % failed)
+        return data.tostring(), corrected
+
+    def nand_status(self):
+        return struct.unpack('<III',
+                self.cmd_recv(NAND_STATUS_COMMAND, 12).tostring())
+
+    def stats(self):
+        # needs CONFIG_STATS on the device, which stalls the request
+        # otherwise; returns counters and histograms by name
+        data = self.cmd_recv(STATS_COMMAND, 256).tostring()
+        num_stats, num_hists, buckets, _, now_us = \
+                struct.unpack_from('<HHHHI', data)
+        counts = struct.unpack_from('<%dI' % (num_stats +
+                num_hists * buckets), data, 12)
+        result = {'now_us': now_us}
+        for i, name in enumerate(STATS_COUNTERS[:num_stats]):
+            result[name] = counts[i]
+        for i, name in enumerate(STATS_HISTS[:num_hists]):
+            base = num_stats + i * buckets
+            result[name] = counts[base:base + buckets]
+        return result
+
+    def stats_reset(self):
+        self.cmd_send(STATS_COMMAND)
+
     def run(self, addr=0):
+        if self.bulk:
+            # the loader may jump before the status frame goes out
+            self.bulk_wait()
+            self.bulk_submit(RUN_COMMAND, struct.pack('<I', addr))
+            return
         self.cmd_send(RUN_COMMAND, data=struct.pack('<I', addr))
 
 
+def find_all():
+    return list(usb.core.find(find_all=True, idVendor=VENDOR_ID,
+            idProduct=PRODUCT_ID))
+
+def port_name(device):
+    # bus-port.port... as Linux names it, so a fixture slot keeps its
+    # name across resets; the device address if the path is unknown
+    ports = getattr(device, 'port_numbers', None)
+    if ports:
+        return '%d-%s' % (device.bus, '.'.join(str(p) for p in ports))
+    return '%d:%d' % (device.bus, device.address)
+
+def flash(device, image, run=True, stats=False, depth=LOAD_DEPTH,
+        bulk=False):
+    # an ELF is loaded and started, anything else is loaded sparse at 0
+    result = {'port': port_name(device), 'bytes': len(image)}
+    start = time.time()
+    try:
+        recovery = Recovery(device, depth)
+        if bulk:
+            recovery.bulk_enable()
+        if stats:
+            before = recovery.stats()
+        if image[:4] == '\x7fELF':
+            entry = recovery.load_elf(image)
+        else:
+            entry = None
+            recovery.load_sparse(image)
+        result['seconds'] = time.time() - start
+        if stats:
+            result['stats'] = (before, recovery.stats())
+        if run and entry is not None:
+            recovery.run(entry)
+    except Exception as e:
+        result['seconds'] = time.time() - start
+        result['error'] = e
+    return result
+
+def flash_fleet(jobs, run=True, stats=False, depth=LOAD_DEPTH, bulk=False):
+    # (device, image) jobs, one thread each; every device keeps its own
+    # LOAD pipeline, so the boards only share the host controller
+    results = [None] * len(jobs)
+
+    def worker(i, device, image):
+        results[i] = flash(device, image, run, stats, depth, bulk)
+
+    threads = [threading.Thread(target=worker, args=(i, device, image))
+            for i, (device, image) in enumerate(jobs)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    return results
+
+def print_results(results, elapsed, out=sys.stdout):
+    failed = [r for r in results if 'error' in r]
+    for r in sorted(results, key=lambda r: r['port']):
+        if 'error' in r:
+            out.write('%-12s FAILED after %.3f s: %s\n' % (
+                    r['port'], r['seconds'], r['error']))
+            continue
+        rate = r['bytes'] / r['seconds'] / (1 << 20) if r['seconds'] else 0
+        out.write('%-12s %10d bytes %8.3f s %8.2f MiB/s  ok\n' % (
+                r['port'], r['bytes'], r['seconds'], rate))
+    total = sum(r['bytes'] for r in results if 'error' not in r)
+    out.write('%d of %d devices ok, %.2f MiB/s aggregate over %.3f s\n' % (
+            len(results) - len(failed), len(results),
+            total / elapsed / (1 << 20) if elapsed else 0, elapsed))
+    return not failed
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+            description='Load and start images over the Pollux recovery '
+            'USB loader.')
+    parser.add_argument('image', nargs='?',
+            help='ELF to load and run, or a raw image to load at 0; '
+            '4 MiB of zeros if omitted')
+    parser.add_argument('-a', '--all', action='store_true',
+            help='flash every recovery device found, in parallel')
+    parser.add_argument('-p', '--port-image', action='append', default=[],
+            metavar='PORT=FILE',
+            help='image for the device on PORT (as printed, e.g. 1-2.3), '
+            'overriding IMAGE; may be repeated')
+    parser.add_argument('-n', '--no-run', action='store_true',
+            help='load only, do not start ELF images')
+    parser.add_argument('-d', '--depth', type=int, default=LOAD_DEPTH,
+            help='LOAD requests in flight per device, 2..%d' % LOAD_DEPTH)
+    parser.add_argument('-b', '--bulk', action='store_true',
+            help='send commands as frames over the bulk endpoints')
+    parser.add_argument('--stats', action='store_true',
+            help='print device statistics after loading '
+            '(needs CONFIG_STATS)')
+    return parser.parse_args()
+
+def read_image(path):
+    if path is None:
+        return '\0' * (4096 * 1024)
+    return open_image(path)
+
+
 if __name__ == '__main__':
-    dev = usb.core.find(idVendor=0x0000, idProduct=0x7f20)
+    args = parse_args()
 
-    if not dev:
+    devices = find_all()
+    if not devices:
         print "no device found"
         sys.exit(-1)
+    if not args.all and not args.port_image:
+        devices = devices[:1]
 
-    recovery = Recovery(dev)
-    data_size = 4096
-    data = '\0' * (data_size * 1024)
-    recovery.load(data)
-    #recovery.run()
+    image = read_image(args.image)
+    port_images = {}
+    for spec in args.port_image:
+        port, sep, path = spec.partition('=')
+        if not sep:
+            print "bad --port-image %s, expected PORT=FILE" % spec
+            sys.exit(-1)
+        port_images[port] = read_image(path)
+    jobs = [(dev, port_images.get(port_name(dev), image)) for dev in devices
+            if args.all or not port_images or port_name(dev) in port_images]
+    # a named port with no board on it is a failure, not a skipped job
+    found = set(port_name(dev) for dev in devices)
+    missing = [{'port': port, 'seconds': 0, 'bytes': 0,
+            'error': 'no recovery device on this port'}
+            for port in sorted(port_images) if port not in found]
 
+    start = time.time()
+    results = flash_fleet(jobs, run=not args.no_run, stats=args.stats,
+            depth=args.depth, bulk=args.bulk)
+    ok = print_results(results + missing, time.time() - start)
+    if args.stats:
+        for r in results:
+            if 'stats' in r:
+                print r['port']
+                print_stats(*r['stats'])
+    sys.exit(0 if ok else 1)
@@ -0,0 +1,399 @@
+/*
+ * Benchmark and fuzzer for the BCH decoder
+ *
+ * Encodes random sectors with a bitwise reference encoder for the Pollux
+ * 4-bit 0x25AF code, flips 0..N random bits across data and ECC, computes
+ * the odd syndromes S1, S3, S5, S7 of the received codeword the way the
+ * NAND controller reports them and times bch_decode() on the result.
+ * bch_encode() and bch_calculate_syndromes() are checked against the
+ * reference on every sector and their throughput is reported as well.
+ *
+ * With -m/-t any other code is run the same way through bch_init_ctrl()
+ * and bch_decode_ctrl(), and -g does that for the built-in code too, so
+ * the generic decoder can be compared against the constant-parameter one.
+ * Every decode is checked by applying the returned locations: any pattern
+ * within the correction capability that does not come back bit-exact is
+ * a failure.  Patterns beyond it are counted as detected or miscorrected.
+ *
+ * The error patterns are drawn from a seeded generator, so a given seed
+ * always replays the same corpus.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bch.h"
+
+#define POLLUX_M	13
+#define MAX_N		((1 << BCH_MAX_M) - 1)
+#define MAX_ECC_BITS	(BCH_MAX_M * BCH_MAX_T)
+#define ECC_WORDS	((MAX_ECC_BITS + 63) / 64)
+#define MAX_LEN		((MAX_N + 7) / 8)
+#define MAX_FLIPS	(BCH_MAX_T + 8)
+
+/* primitive polynomials for m = 5..15, the Pollux one for m = 13 */
+static const unsigned int prim_poly[BCH_MAX_M - 4] = {
+	0x25, 0x43, 0x83, 0x11d, 0x211, 0x409, 0x805, 0x1053, 0x25af,
+	0x402b, 0x8003
+};
+
+static unsigned int gf_m = POLLUX_M, gf_t = BCH_MAX_ERRORS, gf_n;
+static unsigned int ecc_bits, ecc_bytes;
+static unsigned int ref_pow[MAX_N + 1];
+static unsigned int ref_log[MAX_N + 1];
+static uint64_t generator[ECC_WORDS];		/* bit i is the X^i term */
+static unsigned int syn_tab[BCH_MAX_T][256];	/* S(2j+1) of one byte */
+
+static uint16_t ctrl_pow[MAX_N + 1], ctrl_log[MAX_N + 1];
+static struct bch_control ctrl;
+static int generic;
+
+static unsigned int len = 512;
+static unsigned int max_flips = ~0U;
+static unsigned long iterations = 10000;
+static uint64_t seed = 1;
+
+struct result {
+	unsigned long	decodes;
+	unsigned long	sw_mismatch;	/* software encoder/syndromes differ */
+	unsigned long	failed;		/* within capability, not corrected */
+	unsigned long	detected;	/* beyond capability, returned -1 */
+	unsigned long	miscorrected;	/* beyond capability, wrong codeword */
+	double		total_ns;
+	double		worst_ns;
+};
+
+static double encode_ns, syndrome_ns;
+static unsigned long encodes;
+
+/* xorshift64*, so the corpus does not depend on the libc rand() */
+static uint64_t rng(void)
+{
+	seed ^= seed >> 12;
+	seed ^= seed << 25;
+	seed ^= seed >> 27;
+	return seed * 0x2545F4914F6CDD1DULL;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static unsigned int ref_mul(unsigned int a, unsigned int b)
+{
+	return (a && b) ? ref_pow[(ref_log[a] + ref_log[b]) % gf_n] : 0;
+}
+
+static unsigned int ref_apow(unsigned long i)
+{
+	return ref_pow[i % gf_n];
+}
+
+/*
+ * generator polynomial: product of the minimal polynomials of a^1, a^3,
+ * ..., a^(2t-1), built from their conjugate roots the way the decoder
+ * counts them, m*t of them
+ */
+static void build_generator(void)
+{
+	static unsigned int poly[MAX_ECC_BITS + 1];
+	unsigned int deg = 0, i, j, r, root;
+
+	memset(poly, 0, sizeof(poly));
+	memset(generator, 0, sizeof(generator));
+	poly[0] = 1;
+
+	for (i = 1; i < 2 * gf_t; i += 2) {
+		for (r = 0; r < gf_m; r++) {
+			root = ref_apow((unsigned long)i << r);
+			/* multiply by (x + root) */
+			poly[deg + 1] = 0;
+			for (j = deg + 1; j > 0; j--)
+				poly[j] = poly[j - 1] ^ ref_mul(poly[j], root);
+			poly[0] = ref_mul(poly[0], root);
+			deg++;
+		}
+	}
+
+	for (i = 0; i < ecc_bits; i++) {
+		if (poly[i] > 1) {
+			fprintf(stderr, "generator has non-binary terms\n");
+			exit(1);
+		}
+		generator[i / 64] |= (uint64_t)poly[i] << (i % 64);
+	}
+}
+
+static void ref_init(void)
+{
+	unsigned int i, j, k, x = 1, s;
+
+	gf_n = (1 << gf_m) - 1;
+	ecc_bits = gf_m * gf_t;
+	ecc_bytes = (ecc_bits + 7) / 8;
+
+	for (i = 0; i < gf_n; i++) {
+		ref_pow[i] = x;
+		ref_log[x] = i;
+		x <<= 1;
+		if (x & (1 << gf_m))
+			x ^= prim_poly[gf_m - 5];
+	}
+	ref_pow[gf_n] = 1;
+	build_generator();
+
+	/* contribution of a byte, MSB first, to r(a^(2j+1)) */
+	for (j = 0; j < gf_t; j++) {
+		for (k = 0; k < 256; k++) {
+			for (i = 0, s = 0; i < 8; i++)
+				if (k & (0x80 >> i))
+					s ^= ref_apow((2 * j + 1) * (7 - i));
+			syn_tab[j][k] = s;
+		}
+	}
+}
+
+/* ECC bits follow the data MSB first, left-aligned in ecc_bytes bytes */
+static void ref_encode(const uint8_t *data, uint8_t *ecc)
+{
+	const unsigned int top = ecc_bits - 1, words = (ecc_bits + 63) / 64;
+	uint64_t rem[ECC_WORDS];
+	unsigned int i, w, bit, fb;
+
+	memset(rem, 0, sizeof(rem));
+	for (i = 0; i < 8 * len; i++) {
+		bit = (data[i / 8] >> (7 - i % 8)) & 1;
+		fb = ((rem[top / 64] >> (top % 64)) & 1) ^ bit;
+		for (w = words - 1; w > 0; w--)
+			rem[w] = (rem[w] << 1) | (rem[w - 1] >> 63);
+		rem[0] <<= 1;
+		rem[top / 64] &= ~0ULL >> (63 - top % 64);
+		if (fb)
+			for (w = 0; w < words; w++)
+				rem[w] ^= generator[w];
+	}
+
+	memset(ecc, 0, ecc_bytes);
+	for (i = 0; i < ecc_bits; i++)
+		if ((rem[(top - i) / 64] >> ((top - i) % 64)) & 1)
+			ecc[i / 8] |= 0x80 >> (i % 8);
+}
+
+/* S(j) = r(a^j), odd syndromes at even indices as the controller returns */
+static void ref_syndromes(const uint8_t *cw, unsigned int *syn)
+{
+	const unsigned int nbits = 8 * len + ecc_bits;
+	unsigned int i, j, s, aj, aj8;
+
+	for (j = 0; j < gf_t; j++) {
+		aj = ref_apow(2 * j + 1);
+		aj8 = ref_apow(8 * (2 * j + 1));
+
+		for (i = 0, s = 0; i < nbits / 8; i++)
+			s = ref_mul(s, aj8) ^ syn_tab[j][cw[i]];
+		for (i *= 8; i < nbits; i++)
+			s = ref_mul(s, aj) ^ ((cw[i / 8] >> (7 - i % 8)) & 1);
+		syn[2 * j] = s;
+		syn[2 * j + 1] = 0;
+	}
+}
+
+static int builtin(void)
+{
+	return gf_m == POLLUX_M && gf_t == BCH_MAX_ERRORS && !generic;
+}
+
+static void run(unsigned int flips, struct result *res)
+{
+	static uint8_t good[MAX_LEN], cw[MAX_LEN];
+	const unsigned int nbits = 8 * len + ecc_bits;
+	unsigned int syn[2 * BCH_MAX_T], errloc[BCH_MAX_T];
+	unsigned int sw_syn[BCH_SYN_WORDS];
+	uint8_t sw_ecc[BCH_ECC_BYTES];
+	unsigned int pos[MAX_FLIPS];
+	unsigned long it;
+	unsigned int i, j;
+	double start, ns;
+	int n;
+
+	memset(res, 0, sizeof(*res));
+
+	for (it = 0; it < iterations; it++) {
+		for (i = 0; i < len; i++)
+			good[i] = rng();
+		ref_encode(good, good + len);
+		memcpy(cw, good, len + ecc_bytes);
+
+		if (builtin()) {
+			start = now();
+			bch_encode(good, len, sw_ecc);
+			encode_ns += now() - start;
+			encodes++;
+			if (memcmp(sw_ecc, good + len, ecc_bytes))
+				res->sw_mismatch++;
+		}
+
+		for (i = 0; i < flips; i++) {
+again:
+			pos[i] = rng() % nbits;
+			for (j = 0; j < i; j++)
+				if (pos[j] == pos[i])
+					goto again;
+			cw[pos[i] / 8] ^= 0x80 >> (pos[i] % 8);
+		}
+		ref_syndromes(cw, syn);
+
+		if (builtin()) {
+			start = now();
+			bch_calculate_syndromes(cw, len, cw + len, sw_syn);
+			syndrome_ns += now() - start;
+			if (memcmp(sw_syn, syn, sizeof(sw_syn)))
+				res->sw_mismatch++;
+
+			start = now();
+			n = bch_decode(len, syn, errloc);
+			ns = now() - start;
+		} else {
+			start = now();
+			n = bch_decode_ctrl(&ctrl, len, syn, errloc);
+			ns = now() - start;
+		}
+
+		res->decodes++;
+		res->total_ns += ns;
+		if (ns > res->worst_ns)
+			res->worst_ns = ns;
+
+		for (i = 0; n > 0 && i < (unsigned int)n; i++)
+			cw[errloc[i] / 8] ^= 1 << (errloc[i] % 8);
+
+		if (flips <= gf_t) {
+			if (n == (int)flips && !memcmp(cw, good, len + ecc_bytes))
+				continue;
+			res->failed++;
+			fprintf(stderr, "%u errors, iteration %lu: decoded %d,"
+					" flipped bits", flips, it, n);
+			for (i = 0; i < flips; i++)
+				fprintf(stderr, " %u", pos[i]);
+			fprintf(stderr, "\n");
+		} else if (n < 0) {
+			res->detected++;
+		} else {
+			res->miscorrected++;
+		}
+	}
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-n iterations] [-l sector_len] "
+			"[-e max_errors] [-r seed] [-m m] [-t t] [-g]\n", prog);
+	exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+	struct result res;
+	unsigned long failed = 0;
+	unsigned int flips;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:l:e:r:m:t:g")) != -1) {
+		switch (opt) {
+		case 'n':
+			iterations = strtoul(optarg, NULL, 0);
+			break;
+		case 'l':
+			len = strtoul(optarg, NULL, 0);
+			break;
+		case 'e':
+			max_flips = strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			seed = strtoull(optarg, NULL, 0);
+			break;
+		case 'm':
+			gf_m = strtoul(optarg, NULL, 0);
+			break;
+		case 't':
+			gf_t = strtoul(optarg, NULL, 0);
+			break;
+		case 'g':
+			generic = 1;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (max_flips == ~0U)
+		max_flips = gf_t + 1;
+	if (gf_m < 5 || gf_m > BCH_MAX_M || !gf_t || gf_t > BCH_MAX_T ||
+			max_flips > MAX_FLIPS || !seed)
+		usage(argv[0]);
+	if (!len || 8 * len + gf_m * gf_t > (1U << gf_m) - 1) {
+		fprintf(stderr, "sector does not fit a code of length %u\n",
+				(1 << gf_m) - 1);
+		return 1;
+	}
+
+	ref_init();
+	bch_init();
+	if (!builtin() && bch_init_ctrl(&ctrl, gf_m, gf_t,
+			prim_poly[gf_m - 5], ctrl_pow, ctrl_log)) {
+		fprintf(stderr, "bch_init_ctrl(%u, %u) failed\n", gf_m, gf_t);
+		return 1;
+	}
+
+	printf("m=%u t=%u %s decoder, %u-byte sectors, %lu decodes per error "
+			"count, seed %llu\n\n", gf_m, gf_t,
+			builtin() ? "built-in" : "generic", len, iterations,
+			(unsigned long long)seed);
+	printf("%-6s %12s %10s %10s %8s %9s %12s\n", "errors", "decodes/s",
+			"mean ns", "worst ns", "failed", "detected",
+			"miscorrected");
+
+	for (flips = 0; flips <= max_flips; flips++) {
+		run(flips, &res);
+		failed += res.failed + res.sw_mismatch;
+		printf("%-6u %12.0f %10.1f %10.1f %8lu %9lu %12lu\n", flips,
+				res.decodes * 1e9 / res.total_ns,
+				res.total_ns / res.decodes, res.worst_ns,
+				res.failed, res.detected, res.miscorrected);
+		if (res.sw_mismatch)
+			fprintf(stderr, "%lu software encoder/syndrome "
+					"mismatches\n", res.sw_mismatch);
+	}
+
+	if (encodes)
+		printf("\nbch_encode %.1f MiB/s, bch_calculate_syndromes "
+				"%.1f MiB/s\n",
+				encodes * len / encode_ns * 1e9 / (1 << 20),
+				encodes * len / syndrome_ns * 1e9 / (1 << 20));
+
+	if (failed) {
+		fprintf(stderr, "\n%lu checks failed\n", failed);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * Microbenchmark for the UDC FIFO copy kernels
+ *
+ * Times src/udc_fifo.c against the original halfword-per-iteration loops,
+ * for every destination alignment, with the FIFO data register modelled
+ * as a plain volatile halfword (SIM_INLINE_IO).  The OUT side is also
+ * timed with a CRC-32 of each packet, both as the second crc32() pass
+ * udc.c used to make and fused into the drain by udc_fifo_read_crc().
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "asm/io.h"
+#include "asm/types.h"
+
+#include "crc32.h"
+#include "udc_fifo.h"
+
+#define PACKET		512
+#define ITERATIONS	200000
+
+static volatile u16 fifo_reg;
+
+/* the loops udc_read_fifo()/udc_write_fifo() used before */
+static void ref_fifo_read(void __iomem *fifo, u8 *dst, unsigned int len)
+{
+	u16 *buf = (u16 *) dst;
+	int count = (len + 1) / 2;
+	int buflen = len;
+
+	while (count--) {
+		u16 word = readw(fifo);
+		if (buflen > 0) {
+			*buf++ = word;
+			buflen -= 2;
+		}
+	}
+}
+
+static void ref_fifo_write(void __iomem *fifo, const u8 *src, unsigned int len)
+{
+	const u16 *buf = (const u16 *) src;
+	unsigned int count;
+
+	for (count = 0; count < len; count += 2)
+		writew(*buf++, fifo);
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double bench_read(void (*fn)(void __iomem *, u8 *, unsigned int),
+		u8 *dst)
+{
+	double start = now();
+	int i;
+
+	for (i = 0; i < ITERATIONS; i++) {
+		fn((void __iomem *) &fifo_reg, dst, PACKET);
+		asm volatile("" : : "r" (dst) : "memory");
+	}
+	return (now() - start) / ITERATIONS;
+}
+
+static u32 crc;
+
+static void two_pass_read_crc(void __iomem *fifo, u8 *dst, unsigned int len)
+{
+	udc_fifo_read(fifo, dst, len);
+	crc = crc32(crc, dst, len);
+}
+
+static void fused_read_crc(void __iomem *fifo, u8 *dst, unsigned int len)
+{
+	udc_fifo_read_crc(fifo, dst, len, &crc);
+}
+
+static double bench_write(
+		void (*fn)(void __iomem *, const u8 *, unsigned int), u8 *src)
+{
+	double start = now();
+	int i;
+
+	for (i = 0; i < ITERATIONS; i++) {
+		fn((void __iomem *) &fifo_reg, src, PACKET);
+		asm volatile("" : : "r" (src) : "memory");
+	}
+	return (now() - start) / ITERATIONS;
+}
+
+int main(void)
+{
+	static u8 buf[PACKET + 16] __attribute__((aligned(16)));
+
+	u32 crc_two_pass, crc_fused;
+	unsigned int offset;
+
+	memset(buf, 0x5A, sizeof(buf));
+	crc32_init();
+
+	printf("ns per %d byte packet, %d iterations\n\n", PACKET, ITERATIONS);
+	printf("%-8s %10s %10s %10s %10s %10s %10s\n", "offset", "read old",
+			"read new", "+crc32", "read_crc", "write old",
+			"write new");
+	for (offset = 0; offset < 4; offset++) {
+		printf("%-8u %10.1f %10.1f ", offset,
+				bench_read(ref_fifo_read, buf + offset),
+				bench_read(udc_fifo_read, buf + offset));
+		crc = 0;
+		printf("%10.1f ", bench_read(two_pass_read_crc, buf + offset));
+		crc_two_pass = crc;
+		crc = 0;
+		printf("%10.1f ", bench_read(fused_read_crc, buf + offset));
+		crc_fused = crc;
+		printf("%10.1f %10.1f\n",
+				bench_write(ref_fifo_write, buf + offset),
+				bench_write(udc_fifo_write, buf + offset));
+		if (crc_fused != crc_two_pass) {
+			fprintf(stderr, "udc_fifo_read_crc() CRC mismatch\n");
+			return 1;
+		}
+	}
+	return 0;
+}
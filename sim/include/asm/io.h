@@ -0,0 +1,44 @@
+/*
+ * Host shim for asm/io.h, MMIO accesses are routed into the simulator
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _ASM_IO_H
+#define _ASM_IO_H
+
+#include "asm/types.h"
+
+#ifdef SIM_INLINE_IO
+/* plain volatile accesses, for benchmarking code without the simulator */
+static inline u16 readw(const volatile void __iomem *addr)
+{
+	return *(const volatile u16 *) addr;
+}
+
+static inline void writew(u16 val, volatile void __iomem *addr)
+{
+	*(volatile u16 *) addr = val;
+}
+#else
+u16 readw(const volatile void __iomem *addr);
+void writew(u16 val, volatile void __iomem *addr);
+#endif
+
+u8 readb(const volatile void __iomem *addr);
+u32 readl(const volatile void __iomem *addr);
+void writeb(u8 val, volatile void __iomem *addr);
+void writel(u32 val, volatile void __iomem *addr);
+
+#endif /* _ASM_IO_H */
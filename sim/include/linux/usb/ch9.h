@@ -0,0 +1,41 @@
+/*
+ * Host shim for linux/usb/ch9.h, fills in what the uapi header lacks
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _SIM_LINUX_USB_CH9_H
+#define _SIM_LINUX_USB_CH9_H
+
+/*
+ * The uapi string descriptor has a one-element wData[], which the u""
+ * initializers in descriptors.c overflow.  Hide it and declare the
+ * flexible array the target headers use.
+ */
+#define usb_string_descriptor	uapi_usb_string_descriptor
+#include_next <linux/usb/ch9.h>
+#undef usb_string_descriptor
+
+struct usb_string_descriptor {
+	__u8  bLength;
+	__u8  bDescriptorType;
+
+	__le16 wData[];
+} __attribute__ ((packed));
+
+#ifndef USB_DT_DEVICE_QUALIFIER_SIZE
+#define USB_DT_DEVICE_QUALIFIER_SIZE	10
+#endif
+
+#endif /* _SIM_LINUX_USB_CH9_H */
@@ -0,0 +1,124 @@
+/*
+ * Host shim for mach/udc.h
+ *
+ * Register offsets and bits follow the Pollux USB device controller; only
+ * what the UDC stack touches is described.  The simulator decodes accesses
+ * with these same definitions, so the exact values only need to be
+ * self-consistent.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _MACH_UDC_H
+#define _MACH_UDC_H
+
+#define UDC_BASE                0xC0018000
+#define UDC_SIZE                0x1000
+
+#define UDC_IR                  0x000
+#define UDC_EIR                 0x002
+#define UDC_EIER                0x004
+#define UDC_FAR                 0x006
+#define UDC_FNR                 0x008
+#define UDC_EDR                 0x00A
+#define UDC_TR                  0x00C
+#define UDC_SSR                 0x00E
+#define UDC_SCR                 0x010
+#define UDC_EP0SR               0x012
+#define UDC_EP0CR               0x014
+#define UDC_BR(n)               (0x016 + ((n) * 2))
+#define UDC_ESR                 0x04C
+#define UDC_ECR                 0x04E
+#define UDC_BRCR                0x050
+#define UDC_BWCR                0x052
+#define UDC_MPR                 0x054
+#define UDC_DCR                 0x056
+#define UDC_DTCR                0x058
+#define UDC_DFCR                0x05A
+#define UDC_DTTCR1              0x05C
+#define UDC_DTTCR2              0x05E
+#define UDC_PCR                 0x060
+#define UDC_USER1               0x848
+#define UDC_CLKENB              0x8C0
+#define UDC_CLKGEN              0x8C4
+
+/* EIR/EIER */
+#define UDC_EP0                 (1 << 0)
+
+/* TR */
+#define UDC_TR_VBUS             (1 << 15)
+
+/* SSR */
+#define UDC_SSR_RESET           (1 << 0)
+#define UDC_SSR_SUSPEND         (1 << 1)
+#define UDC_SSR_RESUME          (1 << 2)
+#define UDC_SSR_SDE             (1 << 3)
+#define UDC_SSR_HSP             (1 << 4)
+#define UDC_SSR_ERR             (0x1F << 5)
+#define UDC_SSR_VBUSON          (1 << 10)
+#define UDC_SSR_VBUSOFF         (1 << 11)
+#define UDC_SSR_FLAGS           (UDC_SSR_RESET | UDC_SSR_SUSPEND | \
+                                 UDC_SSR_RESUME | UDC_SSR_SDE | \
+                                 UDC_SSR_ERR | UDC_SSR_VBUSON | \
+                                 UDC_SSR_VBUSOFF)
+
+/* SCR */
+#define UDC_SCR_RST_EN          (1 << 0)
+#define UDC_SCR_SUS_EN          (1 << 1)
+#define UDC_SCR_RRD_EN          (1 << 5)
+#define UDC_SCR_DTZIEN_EN       (1 << 14)
+
+/* EP0SR */
+#define UDC_EP0SR_RX_SUCCESS    (1 << 0)
+#define UDC_EP0SR_TX_SUCCESS    (1 << 1)
+#define UDC_EP0SR_STALL         (1 << 4)
+#define UDC_EP0SR_EP0_LWO       (1 << 6)
+
+/* ESR */
+#define UDC_ESR_RX_SUCCESS      (1 << 0)
+#define UDC_ESR_TX_SUCCESS      (1 << 1)
+#define UDC_ESR_PSIF_ONE        (1 << 2)
+#define UDC_ESR_PSIF_TWO        (2 << 2)
+#define UDC_ESR_LWO             (1 << 4)
+#define UDC_ESR_STALL           (1 << 5)
+#define UDC_ESR_FLUSH           (1 << 6)
+#define UDC_ESR_DMA_DONE        (1 << 7)
+
+/* ECR / EP0CR */
+#define UDC_ECR_STALL           (1 << 1)
+#define UDC_ECR_CDP             (1 << 2)
+#define UDC_ECR_FLUSH           (1 << 6)
+#define UDC_ECR_DUEN            (1 << 7)
+#define UDC_ECR_IEMS            (1 << 11)
+
+/* DCR */
+#define UDC_DCR_DEN             (1 << 0)
+#define UDC_DCR_ARDRD           (1 << 1)
+#define UDC_DCR_DMDE            (1 << 3)
+#define UDC_DCR_RDR             (1 << 5)
+
+/* PCR */
+#define UDC_PCR_PCE             (1 << 0)
+
+/* USER1 */
+#define UDC_USER1_VBUSENB       (1 << 15)
+
+/* CLKENB/CLKGEN */
+#define UDC_CLKENB_USBD_ALWAYS  (1 << 0)
+#define UDC_CLKENB_CLKGENENB    (1 << 2)
+#define UDC_CLKENB_PCLK_ALWAYS  (1 << 3)
+#define UDC_CLKGEN_CLKSRC_EXT   (3 << 2)
+#define UDC_CLKGEN_CLKDIV(n)    ((n) << 5)
+
+#endif /* _MACH_UDC_H */
@@ -0,0 +1,221 @@
+/*
+ * Model of a large page NAND chip behind the Pollux static bus window
+ *
+ * Pages are programmed by ANDing into the array as on real flash, so a
+ * missing erase shows up as corrupted data.  Program and erase keep the
+ * chip busy for a fixed amount of host time.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "asm/types.h"
+
+#include "nand_sim.h"
+
+#define NAND_DATA		0x00
+#define NAND_CMD		0x10
+#define NAND_ADDR		0x18
+
+#define PAGE_SIZE		2048
+#define OOB_SIZE		64
+#define RAW_SIZE		(PAGE_SIZE + OOB_SIZE)
+#define PAGES_PER_BLOCK		64
+
+/* 256 MiB, 2 KiB pages, 64 byte spare, 128 KiB blocks */
+static const u8 nand_id[4] = { 0xEC, 0xDA, 0x10, 0x95 };
+
+enum nand_sim_mode {
+	MODE_IDLE,
+	MODE_ID,
+	MODE_STATUS,
+	MODE_READ,
+	MODE_PROGRAM,
+	MODE_ERASE,
+};
+
+static struct {
+	u8			*array;
+	u32			pages;
+	u8			buf[RAW_SIZE];
+	enum nand_sim_mode	mode;
+	u8			cmd;
+	u64			addr;
+	unsigned int		addr_cycles;
+	unsigned int		pos;
+	double			ready_at;
+	double			read_ns;
+	double			prog_ns;
+	double			erase_ns;
+} nand;
+
+struct nand_sim_stats nand_sim_stats;
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void busy_for(double ns)
+{
+	double t = now();
+
+	nand.ready_at = t + ns;
+	nand_sim_stats.busy_ns += ns;
+}
+
+static u32 row(void)
+{
+	return (nand.cmd == 0x60) ? nand.addr : nand.addr >> 16;
+}
+
+static void command(u8 cmd)
+{
+	u32 page, i;
+
+	switch (cmd) {
+	case 0xFF:		/* reset */
+		nand.mode = MODE_IDLE;
+		break;
+
+	case 0x90:		/* read id */
+		nand.mode = MODE_ID;
+		nand.pos = 0;
+		break;
+
+	case 0x70:		/* status */
+		nand.mode = MODE_STATUS;
+		break;
+
+	case 0x00:		/* read, or back to data output after status */
+		nand.mode = MODE_READ;
+		break;
+
+	case 0x30:		/* read start */
+		page = row();
+		if (nand.mode == MODE_READ && page < nand.pages) {
+			memcpy(nand.buf, nand.array + page * RAW_SIZE,
+					RAW_SIZE);
+			nand.pos = nand.addr & 0xFFFF;
+			nand_sim_stats.reads++;
+			busy_for(nand.read_ns);
+		}
+		break;
+
+	case 0x80:		/* serial data in */
+		nand.mode = MODE_PROGRAM;
+		memset(nand.buf, 0xFF, sizeof(nand.buf));
+		break;
+
+	case 0x10:		/* page program */
+		page = row();
+		if (nand.mode == MODE_PROGRAM && page < nand.pages) {
+			for (i = 0; i < RAW_SIZE; i++)
+				nand.array[page * RAW_SIZE + i] &= nand.buf[i];
+			nand_sim_stats.programs++;
+			busy_for(nand.prog_ns);
+		}
+		nand.mode = MODE_IDLE;
+		break;
+
+	case 0x60:		/* block erase setup */
+		nand.mode = MODE_ERASE;
+		break;
+
+	case 0xD0:		/* block erase */
+		page = row() & ~(PAGES_PER_BLOCK - 1);
+		if (nand.mode == MODE_ERASE && page < nand.pages) {
+			memset(nand.array + page * RAW_SIZE, 0xFF,
+					PAGES_PER_BLOCK * RAW_SIZE);
+			nand_sim_stats.erases++;
+			busy_for(nand.erase_ns);
+		}
+		nand.mode = MODE_IDLE;
+		break;
+	}
+
+	nand.cmd = cmd;
+	nand.addr = 0;
+	nand.addr_cycles = 0;
+}
+
+u8 nand_sim_read(unsigned int offset)
+{
+	if (offset != NAND_DATA)
+		return 0;
+
+	switch (nand.mode) {
+	case MODE_ID:
+		return (nand.pos < sizeof(nand_id)) ? nand_id[nand.pos++] : 0;
+	case MODE_READ:
+		return (nand.pos < RAW_SIZE) ? nand.buf[nand.pos++] : 0xFF;
+	case MODE_STATUS:
+		nand_sim_stats.status_polls++;
+		return (now() >= nand.ready_at) ? 0xC0 : 0x80;
+	default:
+		return 0;
+	}
+}
+
+void nand_sim_write(unsigned int offset, u8 val)
+{
+	switch (offset) {
+	case NAND_CMD:
+		command(val);
+		break;
+
+	case NAND_ADDR:
+		nand.addr |= (u64) val << (8 * nand.addr_cycles++);
+		if (nand.mode == MODE_PROGRAM && nand.addr_cycles == 2)
+			nand.pos = nand.addr;
+		break;
+
+	case NAND_DATA:
+		if (nand.mode == MODE_PROGRAM && nand.pos < RAW_SIZE)
+			nand.buf[nand.pos++] = val;
+		break;
+	}
+}
+
+void nand_sim_init(u32 pages, unsigned int read_us, unsigned int prog_us,
+		unsigned int erase_us)
+{
+	u32 i;
+
+	free(nand.array);
+	memset(&nand, 0, sizeof(nand));
+	memset(&nand_sim_stats, 0, sizeof(nand_sim_stats));
+
+	nand.pages = (pages + PAGES_PER_BLOCK - 1) & ~(PAGES_PER_BLOCK - 1);
+	nand.array = malloc(nand.pages * RAW_SIZE);
+	/* factory state is erased, but dirty it to catch missing erases */
+	memset(nand.array, 0x00, nand.pages * RAW_SIZE);
+	/* and leave the bad block markers good */
+	for (i = 0; i < nand.pages; i += PAGES_PER_BLOCK)
+		nand.array[i * RAW_SIZE + PAGE_SIZE] = 0xFF;
+	nand.read_ns = read_us * 1e3;
+	nand.prog_ns = prog_us * 1e3;
+	nand.erase_ns = erase_us * 1e3;
+}
+
+u8 *nand_sim_page(u32 page)
+{
+	return (page < nand.pages) ? nand.array + page * RAW_SIZE : NULL;
+}
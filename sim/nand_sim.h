@@ -0,0 +1,43 @@
+/*
+ * Model of a large page NAND chip behind the Pollux static bus window
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _NAND_SIM_H
+#define _NAND_SIM_H
+
+#include "asm/types.h"
+
+#define NAND_SIM_BASE		0xAC000000
+#define NAND_SIM_SIZE		0x20
+
+struct nand_sim_stats {
+	unsigned long		reads;
+	unsigned long		programs;
+	unsigned long		erases;
+	unsigned long		status_polls;
+	double			busy_ns;
+};
+
+extern struct nand_sim_stats nand_sim_stats;
+
+void nand_sim_init(u32 pages, unsigned int read_us, unsigned int prog_us,
+		unsigned int erase_us);
+u8 *nand_sim_page(u32 page);
+
+u8 nand_sim_read(unsigned int offset);
+void nand_sim_write(unsigned int offset, u8 val);
+
+#endif /* _NAND_SIM_H */
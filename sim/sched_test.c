@@ -0,0 +1,174 @@
+/*
+ * Test for the cooperative scheduler
+ *
+ * Runs src/sched.c against a hand-driven msecs and checks the order and
+ * the time at which tasks run: sleepers wake in wake-time order and not
+ * before their time, task_wake() ends a sleep early without a second
+ * run at the old wake time, the sleep queue stays ordered across the
+ * wrap of msecs, and a task woken while it runs is not lost when it
+ * stops itself.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sched.h"
+
+#define MAX_EVENTS	16
+
+unsigned int msecs;		/* timer.c is not simulated, tick() drives it */
+
+/* which task ran at what time, in order */
+static struct {
+	char		name;
+	unsigned int	at;
+} events[MAX_EVENTS];
+static unsigned int nevents;
+static unsigned int failed;
+
+static struct task task_a, task_b, task_c;
+static bool rewake;
+
+static void record(char name)
+{
+	if (nevents < MAX_EVENTS) {
+		events[nevents].name = name;
+		events[nevents].at = msecs;
+	}
+	nevents++;
+}
+
+static void a_run(void)
+{
+	record('a');
+	task_stop(&task_a);
+}
+
+static void b_run(void)
+{
+	record('b');
+	task_stop(&task_b);
+}
+
+/* stands in for a task whose callback fires while it runs */
+static void c_run(void)
+{
+	record('c');
+	if (rewake) {
+		rewake = false;
+		task_wake(&task_c);
+	}
+	task_stop(&task_c);
+}
+
+static struct task task_a = TASK_INIT(task_a, a_run);
+static struct task task_b = TASK_INIT(task_b, b_run);
+static struct task task_c = TASK_INIT(task_c, c_run);
+
+static void reset(unsigned int now)
+{
+	task_stop(&task_a);
+	task_stop(&task_b);
+	task_stop(&task_c);
+	msecs = now;
+	nevents = 0;
+}
+
+/* one main loop pass per millisecond */
+static void tick(unsigned int ms)
+{
+	while (ms--) {
+		sched_run();
+		msecs++;
+	}
+	sched_run();
+}
+
+/* @expect is "name@offset ..." with offsets from @base */
+static void check(const char *test, unsigned int base, const char *expect)
+{
+	char got[MAX_EVENTS * 16] = "", *p = got;
+	unsigned int i;
+	int ok;
+
+	for (i = 0; i < nevents && i < MAX_EVENTS; i++)
+		p += sprintf(p, "%s%c@%u", i ? " " : "", events[i].name,
+				events[i].at - base);
+	ok = !strcmp(got, expect);
+	if (!ok) {
+		fprintf(stderr, "%s: ran \"%s\", expected \"%s\"\n", test,
+				got, expect);
+		failed++;
+	}
+	printf("%-12s %s\n", test, ok ? "ok" : "FAIL");
+}
+
+static void test_order(unsigned int base)
+{
+	reset(base);
+	task_sleep(&task_a, 30);
+	task_sleep(&task_b, 10);
+	task_sleep(&task_c, 20);
+	tick(40);
+	check(base ? "order, wrap" : "order", base, "b@10 c@20 a@30");
+}
+
+static void test_early_wake(void)
+{
+	reset(100);
+	task_sleep(&task_a, 50);
+	task_sleep(&task_b, 20);
+	tick(5);
+	task_wake(&task_a);
+	tick(60);
+	check("early wake", 100, "a@5 b@20");
+}
+
+static void test_resleep(void)
+{
+	reset(200);
+	task_sleep(&task_a, 10);
+	tick(3);
+	task_sleep(&task_a, 20);
+	tick(30);
+	check("resleep", 200, "a@23");
+}
+
+static void test_lost_wakeup(void)
+{
+	reset(300);
+	rewake = true;
+	task_wake(&task_c);
+	tick(3);
+	check("lost wakeup", 300, "c@0 c@1");
+}
+
+int main(void)
+{
+	test_order(0);
+	test_early_wake();
+	test_resleep();
+	test_lost_wakeup();
+	/* wake times on both sides of the msecs wrap */
+	test_order(-15);
+	test_order(-30);
+
+	if (failed) {
+		fprintf(stderr, "\n%u checks failed\n", failed);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,1385 @@
+/*
+ * UDC throughput benchmark on top of the register simulator
+ *
+ * Links the real src/udc.c and src/udc_driver.c, enumerates the device
+ * with a scripted host, issues a vendor LOAD and streams the payload over
+ * EP1.  MMIO traffic and host time are reported per EP0 control transfer
+ * and per EP1 packet, and the CRC-32 the device summed on receive is
+ * checked against a bitwise reference.  With -z, a compressible image is
+ * also sent LZ4 compressed with LOAD_LZ4 and checked after decoding; -S
+ * sends an image of fill and don't care runs with LOAD_SPARSE, and -G
+ * scatters the payload over several segments with one LOAD_SG.
+ * With -p, a NAND PROGRAM run is streamed into the NAND model as well and
+ * the programmed pages are checked; -d then flips random bits in them and
+ * reads them back with NAND DUMP over EP2.  From two blocks on, an
+ * unaligned start and a bad block must be refused.  -B compares LOAD_CRC
+ * queries over EP0 with command frames over the bulk endpoints, then
+ * loads the payload again with LOAD frames.  -R resets the bus while a
+ * LOAD_LZ4 and then a LOAD_SPARSE wait for their data, and with -n while
+ * a NAND PROGRAM has two pages in; LOAD and the command that was cut off
+ * must work again after enumeration.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#define _GNU_SOURCE
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "asm/types.h"
+#include "baremetal/util.h"
+#include "linux/usb/ch9.h"
+
+#include "bch.h"
+#include "sched.h"
+#include "udc.h"
+#include "udc_driver.h"
+#include "nand_sim.h"
+#include "udc_sim.h"
+
+#define LOAD_COMMAND		0
+#define NAND_PROGRAM_COMMAND	2
+#define NAND_STATUS_COMMAND	3
+#define NAND_DUMP_COMMAND	4
+#define LOAD_CRC_COMMAND	5
+#define LOAD_LZ4_COMMAND	6
+#define LOAD_SPARSE_COMMAND	7
+#define LOAD_SG_COMMAND		8
+#define BULK_COMMAND		10
+#define MAX_POLLS		1000
+
+#define LZ4_STAGE_SIZE		(16 * 1024)
+#define LZ4_BLOCK_MAX		(64 * 1024)
+#define LZ4_BLOCK_STORED	(1u << 31)
+#define LZ4_HASH_BITS		12
+
+#define LOAD_SG_MAX		32
+
+#define BULK_COMMAND_MAGIC	0x444D4352
+#define BULK_STATUS_MAGIC	0x53545352
+#define BULK_HEADER_SIZE	16
+#define BULK_PAYLOAD_MAX	256
+#define BULK_DEPTH		4
+#define BULK_QUERIES		256
+
+#define SPARSE_BLOCK		4096
+#define SPARSE_MAX_CHUNKS	42
+#define SPARSE_CHUNK_RAW	0xCAC1
+#define SPARSE_CHUNK_FILL	0xCAC2
+#define SPARSE_CHUNK_DONT_CARE	0xCAC3
+#define SPARSE_UNTOUCHED	0xA5
+
+#define NAND_PAGE_SIZE		2048
+#define NAND_OOB_SIZE		64
+#define NAND_SECTORS		(NAND_PAGE_SIZE / 512)
+#define NAND_ECC_POS		(NAND_OOB_SIZE - NAND_SECTORS * BCH_ECC_BYTES)
+#define NAND_PAGES_PER_BLOCK	64
+#define NAND_READ_US		25
+#define NAND_PROG_US		200
+#define NAND_ERASE_US		1500
+
+bool timeout_aborted;
+unsigned int msecs;		/* timer.c is not simulated, poll() ticks it */
+
+static unsigned int mmio_cycles = 4;
+static unsigned int offset;
+static unsigned int segments = 1;
+static unsigned int nand_pages;
+static bool nand_dump_pages;
+static bool lz4_load_image;
+static bool sparse_load_image;
+static unsigned int sg_segments;
+static bool high_speed = true;
+static bool bulk_frames;
+static bool bus_resets;
+
+struct bulk_header {
+	u32			magic;
+	u32			tag;
+	u32			length;
+	u8			command;
+	u8			status;
+	u16			reserved;
+};
+
+struct sample {
+	struct sim_stats	stats;
+	struct timespec		ts;
+};
+
+static void sample(struct sample *s)
+{
+	s->stats = sim_stats;
+	clock_gettime(CLOCK_MONOTONIC, &s->ts);
+}
+
+static double elapsed_ns(const struct sample *a, const struct sample *b)
+{
+	return (b->ts.tv_sec - a->ts.tv_sec) * 1e9 +
+			(b->ts.tv_nsec - a->ts.tv_nsec);
+}
+
+static unsigned long mmio(const struct sample *a, const struct sample *b)
+{
+	return (b->stats.reads - a->stats.reads) +
+			(b->stats.writes - a->stats.writes);
+}
+
+static unsigned long fifo(const struct sample *a, const struct sample *b)
+{
+	return (b->stats.fifo_reads - a->stats.fifo_reads) +
+			(b->stats.fifo_writes - a->stats.fifo_writes);
+}
+
+static void report(const char *name, unsigned int units, unsigned int bytes,
+		const struct sample *a, const struct sample *b)
+{
+	double n = units ? units : 1;
+
+	printf("%-24s %6u %9u %9.1f %9.1f %9.1f %9.1f\n", name, units, bytes,
+			mmio(a, b) / n, fifo(a, b) / n,
+			mmio(a, b) * mmio_cycles / n, elapsed_ns(a, b) / n);
+}
+
+static int control(u8 type, u8 request, u16 value, u16 index,
+		void *data, u16 length)
+{
+	struct usb_ctrlrequest ctrl = {
+		.bRequestType = type,
+		.bRequest = request,
+		.wValue = value,
+		.wIndex = index,
+		.wLength = length,
+	};
+	unsigned int mps = high_speed ? 64 : 8;
+	unsigned int done = 0, chunk;
+	int polls, len;
+
+	sim_ep0_setup(&ctrl);
+	for (polls = 0; sim_ep0_busy() && polls < MAX_POLLS; polls++)
+		udc_task();
+
+	if (sim_ep0_stalled())
+		goto stall;
+
+	if (type & USB_DIR_IN) {
+		for (polls = 0; done < length && polls < MAX_POLLS; polls++) {
+			len = sim_ep_in(0, (u8 *)data + done, length - done);
+			if (len < 0) {
+				udc_task();
+				continue;
+			}
+			done += len;
+			if ((unsigned int)len < mps)
+				break;
+		}
+	} else {
+		while (done < length) {
+			chunk = min(length - done, mps);
+			if (!sim_ep_out(0, (u8 *)data + done, chunk))
+				break;
+			for (polls = 0; sim_ep0_busy() && polls < MAX_POLLS;
+					polls++)
+				udc_task();
+			if (sim_ep0_stalled())
+				goto stall;
+			done += chunk;
+		}
+	}
+	return done;
+
+stall:
+	sim_ep0_clear_stall();
+	udc_task();
+	return -1;
+}
+
+static void enumerate(void)
+{
+	struct usb_device_descriptor dev;
+	u8 config[64];
+	struct sample a, b;
+
+	sample(&a);
+	control(USB_DIR_IN, USB_REQ_GET_DESCRIPTOR, USB_DT_DEVICE << 8, 0,
+			&dev, sizeof(dev));
+	sample(&b);
+	report("GET_DESCRIPTOR(device)", 1, sizeof(dev), &a, &b);
+
+	sample(&a);
+	control(USB_DIR_OUT, USB_REQ_SET_ADDRESS, 1, 0, NULL, 0);
+	sample(&b);
+	report("SET_ADDRESS", 1, 0, &a, &b);
+
+	sample(&a);
+	control(USB_DIR_IN, USB_REQ_GET_DESCRIPTOR, USB_DT_CONFIG << 8, 0,
+			config, sizeof(config));
+	sample(&b);
+	report("GET_DESCRIPTOR(config)", 1, config[2], &a, &b);
+
+	sample(&a);
+	control(USB_DIR_OUT, USB_REQ_SET_CONFIGURATION, 1, 0, NULL, 0);
+	sample(&b);
+	report("SET_CONFIGURATION", 1, 0, &a, &b);
+}
+
+/* requests for an endpoint past the last one must stall */
+static int missing_endpoint(void)
+{
+	u16 status;
+
+	if (control(USB_DIR_IN | USB_RECIP_ENDPOINT, USB_REQ_GET_STATUS, 0,
+			NUM_ENDPOINTS, &status, sizeof(status)) >= 0 ||
+			control(USB_RECIP_ENDPOINT, USB_REQ_SET_FEATURE,
+			USB_ENDPOINT_HALT, NUM_ENDPOINTS, NULL, 0) >= 0) {
+		fprintf(stderr, "request for endpoint %d not refused\n",
+				NUM_ENDPOINTS);
+		return -1;
+	}
+	return 0;
+}
+
+/* bitwise zlib CRC-32, independent of the table driven src/crc32.c */
+static u32 ref_crc32(u32 crc, const u8 *buf, u32 len)
+{
+	int i;
+
+	crc = ~crc;
+	while (len--) {
+		crc ^= *buf++;
+		for (i = 0; i < 8; i++)
+			crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+	}
+	return ~crc;
+}
+
+static int load_crc(u32 expected, u32 length)
+{
+	u32 crc[3];
+
+	if (control(USB_DIR_IN | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, LOAD_CRC_COMMAND, 0, crc, sizeof(crc)) !=
+			sizeof(crc)) {
+		fprintf(stderr, "LOAD CRC command failed\n");
+		return -1;
+	}
+	printf("LOAD CRC-32 %08x over %u bytes", crc[0], crc[1]);
+	if (crc[2] || crc[1] != length || crc[0] != expected) {
+		printf(", expected %08x over %u bytes\n", expected, length);
+		return -1;
+	}
+	printf("\n");
+	return 0;
+}
+
+static int load(u8 *target, u32 length)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	u32 cmd[2];
+	struct sample a, b;
+	u8 *image;
+	u32 sent, chunk, packets = 0, seg_len;
+	int polls, ret = 0;
+
+	image = malloc(length);
+	if (!image)
+		return -1;
+	srand(length);
+	for (sent = 0; sent < length; sent++)
+		image[sent] = rand();
+	memset(target, 0, length);
+
+	/* queue every segment up front, the data then streams without gaps */
+	seg_len = (length / segments + mps - 1) / mps * mps;
+	sample(&a);
+	for (sent = 0; sent < length; sent += seg_len) {
+		cmd[0] = (u32)(unsigned long) (target + sent);
+		cmd[1] = min(seg_len, length - sent);
+		if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+				0x40, LOAD_COMMAND, 0, cmd, sizeof(cmd)) < 0) {
+			fprintf(stderr, "LOAD command stalled\n");
+			free(image);
+			return -1;
+		}
+		packets++;
+	}
+	sample(&b);
+	report("VENDOR LOAD (EP0)", packets, sizeof(cmd), &a, &b);
+
+	sample(&a);
+	sent = 0;
+	packets = 0;
+	for (polls = 0; sent < length && polls < MAX_POLLS; polls++) {
+		/* the bus fills both packet buffers between polls */
+		chunk = min(length - sent, mps);
+		while (sent < length && sim_ep_out(1, image + sent, chunk)) {
+			sent += chunk;
+			packets++;
+			polls = 0;
+			chunk = min(length - sent, mps);
+		}
+		udc_task();
+	}
+	for (polls = 0; sim_ep_out_busy(1) && polls < MAX_POLLS; polls++)
+		udc_task();
+	sample(&b);
+	report("BULK LOAD (EP1 packet)", packets, mps, &a, &b);
+
+	printf("\nEP1: %.3f bytes/MMIO, %.1f MiB/s simulated host rate\n",
+			(double) length / (mmio(&a, &b) ? mmio(&a, &b) : 1),
+			length / (elapsed_ns(&a, &b) / 1e9) / (1 << 20));
+
+	if (memcmp(target, image, length)) {
+		fprintf(stderr, "LOAD payload mismatch\n");
+		ret = -1;
+	}
+	if (load_crc(ref_crc32(0, image, length), length))
+		ret = -1;
+	free(image);
+	return ret;
+}
+
+static void poll(void)
+{
+	udc_task();
+	sched_run();
+	msecs++;
+}
+
+/* one bulk OUT transfer on EP1, running the device between packets */
+static int send(const u8 *data, u32 len, unsigned int *packets)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	unsigned int polls;
+	u32 pos, chunk;
+
+	for (pos = 0; pos < len; pos += chunk) {
+		chunk = min(len - pos, mps);
+		for (polls = 0; !sim_ep_out(1, data + pos, chunk); polls++) {
+			if (polls == MAX_POLLS)
+				return -1;
+			poll();
+		}
+		(*packets)++;
+	}
+	return 0;
+}
+
+static u32 read32(const u8 *p)
+{
+	u32 v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static u8 *lz4_put_length(u8 *op, unsigned int len)
+{
+	for (; len >= 255; len -= 255)
+		*op++ = 255;
+	*op++ = len;
+	return op;
+}
+
+/*
+ * Greedy single-probe LZ4 block compressor, as a stand-in for the host's
+ * lz4 module.  Keeps the format's end rules: the last 5 bytes are always
+ * literals and no match starts in the last 12.  Returns the compressed
+ * length, or 0 if it does not fit in @max bytes.
+ */
+static unsigned int lz4_compress(const u8 *src, unsigned int len, u8 *dst,
+		unsigned int max)
+{
+	static u32 table[1 << LZ4_HASH_BITS];
+	const u8 *ip = src, *anchor = src, *end = src + len, *ref;
+	const u8 *mflimit = (len > 12) ? end - 12 : src;
+	u8 *op = dst, *oend = dst + max, *token;
+	unsigned int h, lit, mlen;
+
+	memset(table, 0, sizeof(table));
+
+	while (ip < mflimit) {
+		h = (read32(ip) * 2654435761u) >> (32 - LZ4_HASH_BITS);
+		ref = table[h] ? src + table[h] - 1 : NULL;
+		table[h] = ip - src + 1;
+		if (!ref || ip - ref > 65535 || read32(ref) != read32(ip)) {
+			ip++;
+			continue;
+		}
+
+		for (mlen = 4; ip + mlen < end - 5 && ip[mlen] == ref[mlen];)
+			mlen++;
+		lit = ip - anchor;
+		if (op + 1 + lit / 255 + 1 + lit + 2 + mlen / 255 + 1 > oend)
+			return 0;
+
+		token = op++;
+		*token = ((lit < 15) ? lit : 15) << 4;
+		if (lit >= 15)
+			op = lz4_put_length(op, lit - 15);
+		memcpy(op, anchor, lit);
+		op += lit;
+		*op++ = (ip - ref) & 0xFF;
+		*op++ = (ip - ref) >> 8;
+		*token |= (mlen - 4 < 15) ? mlen - 4 : 15;
+		if (mlen - 4 >= 15)
+			op = lz4_put_length(op, mlen - 4 - 15);
+
+		ip += mlen;
+		anchor = ip;
+	}
+
+	lit = end - anchor;
+	if (op + 1 + lit / 255 + 1 + lit > oend)
+		return 0;
+	token = op++;
+	*token = ((lit < 15) ? lit : 15) << 4;
+	if (lit >= 15)
+		op = lz4_put_length(op, lit - 15);
+	memcpy(op, anchor, lit);
+	op += lit;
+	return op - dst;
+}
+
+/* zero runs, repeated text and random bytes, roughly like a rootfs */
+static void lz4_image(u8 *image, u32 length)
+{
+	static const char *const words[] = {
+		"usr", "lib", "bin", "libc.so.6", "GLIBC_2.4", "/etc/init.d",
+		"ld-linux.so.3", "__libc_start_main", " ", "\n", "\0\0\0\0",
+	};
+	const char *w;
+	u32 pos = 0, n;
+
+	srand(length);
+	while (pos < length) {
+		n = min(length - pos, (u32) (rand() % 4096 + 1));
+		switch (rand() % 4) {
+		case 0:
+			memset(image + pos, 0, n);
+			pos += n;
+			break;
+		case 1:
+			while (n-- && pos < length)
+				image[pos++] = rand();
+			break;
+		default:
+			while (n && pos < length) {
+				w = words[rand() % (sizeof(words) / sizeof(words[0]))];
+				while (*w && n && pos < length) {
+					image[pos++] = *w++;
+					n--;
+				}
+			}
+		}
+	}
+}
+
+static int lz4_load(u8 *target, u32 length)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	u8 *image, *xfer, *p;
+	u32 cmd[2], pos, block, size, sent, xfer_len = 0;
+	unsigned int blocks = 0, packets = 0, polls;
+	struct sample a, b;
+	int ret = 0;
+
+	image = malloc(length);
+	/* worst case is every block stored with a header and pad byte */
+	xfer = malloc(length + (length / 1024 + 1) * 5);
+	if (!image || !xfer)
+		return -1;
+	lz4_image(image, length);
+	memset(target, 0, length);
+
+	/*
+	 * One transfer per block, the largest input that compresses into a
+	 * staging buffer; a transfer that would end on a full packet gets a
+	 * pad byte so the short packet still ends it.
+	 */
+	for (pos = 0; pos < length; pos += block) {
+		p = xfer + xfer_len;
+		for (block = min(length - pos, (u32) LZ4_BLOCK_MAX); ;
+				block /= 2) {
+			size = lz4_compress(image + pos, block, p + 4,
+					LZ4_STAGE_SIZE - 4);
+			if (size && size < block)
+				break;
+			if (block <= LZ4_STAGE_SIZE - 4) {
+				memcpy(p + 4, image + pos, block);
+				size = block | LZ4_BLOCK_STORED;
+				break;
+			}
+		}
+		memcpy(p, &size, 4);
+		size = 4 + (size & ~LZ4_BLOCK_STORED);
+		if (!(size % mps) && size != LZ4_STAGE_SIZE)
+			p[size++] = 0;
+		xfer_len += size;
+		blocks++;
+	}
+
+	cmd[0] = (u32)(unsigned long) target;
+	cmd[1] = length;
+	sample(&a);
+	if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, LOAD_LZ4_COMMAND, 0, cmd, sizeof(cmd)) < 0) {
+		fprintf(stderr, "LOAD_LZ4 command stalled\n");
+		ret = -1;
+		goto out;
+	}
+
+	/* walk the blocks again to send one transfer each */
+	for (sent = 0; sent < xfer_len; sent += size) {
+		memcpy(&size, xfer + sent, 4);
+		size = 4 + (size & ~LZ4_BLOCK_STORED);
+		if (!(size % mps) && size != LZ4_STAGE_SIZE)
+			size++;
+		if (send(xfer + sent, size, &packets)) {
+			fprintf(stderr, "LOAD_LZ4 stalled\n");
+			ret = -1;
+			goto out;
+		}
+	}
+	/* each poll decodes at most one staged block */
+	for (polls = 0; (sim_ep_out_busy(1) || polls < 4) &&
+			polls < MAX_POLLS; polls++)
+		poll();
+	sample(&b);
+	report("LZ4 LOAD (EP1 packet)", packets, mps, &a, &b);
+
+	printf("\nLZ4: %u blocks, %u -> %u bytes (%.2f:1), %.3f output "
+			"bytes/MMIO, %.1f MiB/s output rate\n", blocks,
+			xfer_len, length, (double) length / xfer_len,
+			(double) length / (mmio(&a, &b) ? mmio(&a, &b) : 1),
+			length / (elapsed_ns(&a, &b) / 1e9) / (1 << 20));
+
+	if (memcmp(target, image, length)) {
+		fprintf(stderr, "LOAD_LZ4 output mismatch\n");
+		ret = -1;
+	}
+	if (load_crc(ref_crc32(0, image, length), length))
+		ret = -1;
+out:
+	free(xfer);
+	free(image);
+	return ret;
+}
+
+/*
+ * Segments of odd lengths spread over the target with a gap after each,
+ * the way ELF program headers usually land.  The gaps must stay as the
+ * target was preset.
+ */
+static int sg_load(u8 *target, u32 length)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	u32 table[LOAD_SG_MAX][2], stride = length / sg_segments;
+	u32 i, pos, seg_len, stream_len = 0, total = 0, crc = 0;
+	unsigned int packets = 0, polls;
+	u8 *image, *stream;
+	struct sample a, b;
+	int ret = 0;
+
+	image = malloc(length);
+	stream = malloc(length + sg_segments * mps);
+	if (!image || !stream)
+		return -1;
+	srand(length);
+	memset(image, SPARSE_UNTOUCHED, length);
+	memset(target, SPARSE_UNTOUCHED, length);
+
+	for (i = 0; i < sg_segments; i++) {
+		seg_len = stride - 1 - rand() % min(stride, 256u);
+		table[i][0] = (u32)(unsigned long) (target + i * stride);
+		table[i][1] = seg_len;
+		for (pos = 0; pos < seg_len; pos++)
+			image[i * stride + pos] = rand();
+		crc = ref_crc32(crc, image + i * stride, seg_len);
+		total += seg_len;
+
+		/* each segment starts on a fresh packet */
+		memcpy(stream + stream_len, image + i * stride, seg_len);
+		stream_len += seg_len;
+		memset(stream + stream_len, 0, -seg_len % mps);
+		stream_len += -seg_len % mps;
+	}
+
+	sample(&a);
+	if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, LOAD_SG_COMMAND, 0, table,
+			sg_segments * sizeof(table[0])) < 0) {
+		fprintf(stderr, "LOAD_SG command stalled\n");
+		ret = -1;
+		goto out;
+	}
+	sample(&b);
+	report("VENDOR LOAD_SG (EP0)", 1, sg_segments * sizeof(table[0]),
+			&a, &b);
+
+	sample(&a);
+	if (send(stream, stream_len, &packets)) {
+		fprintf(stderr, "LOAD_SG stalled\n");
+		ret = -1;
+		goto out;
+	}
+	for (polls = 0; sim_ep_out_busy(1) && polls < MAX_POLLS; polls++)
+		poll();
+	sample(&b);
+	report("SG LOAD (EP1 packet)", packets, mps, &a, &b);
+
+	printf("\nSG: %u segments, %u bytes in %u on the wire, %.3f "
+			"bytes/MMIO, %.1f MiB/s simulated host rate\n",
+			sg_segments, total, stream_len,
+			(double) total / (mmio(&a, &b) ? mmio(&a, &b) : 1),
+			total / (elapsed_ns(&a, &b) / 1e9) / (1 << 20));
+
+	if (memcmp(target, image, length)) {
+		fprintf(stderr, "LOAD_SG payload mismatch\n");
+		ret = -1;
+	}
+	if (load_crc(crc, total))
+		ret = -1;
+out:
+	free(stream);
+	free(image);
+	return ret;
+}
+
+struct sparse_chunk {
+	u16 type;
+	u16 reserved;
+	u32 length;
+	u32 fill;
+};
+
+/*
+ * Random runs of 4 KiB blocks: zeros, erased flash, a fill pattern, don't
+ * care and real data.  Don't care blocks hold what the target is preset
+ * to, as the device must leave them alone.
+ */
+static unsigned int sparse_image(u8 *image, u32 length,
+		struct sparse_chunk *chunks)
+{
+	static const u32 fills[] = { 0x00000000, 0xFFFFFFFF, 0xE7FE0000 };
+	struct sparse_chunk *c = chunks - 1;
+	u32 pos, n, i, fill = 0;
+	u16 type;
+	int kind;
+
+	srand(length);
+	for (pos = 0; pos < length; pos += n) {
+		n = min(length - pos, (u32) SPARSE_BLOCK);
+		kind = rand() % 8;
+		if (kind < 3) {
+			type = SPARSE_CHUNK_FILL;
+			fill = fills[kind];
+			for (i = 0; i < n; i += 4)
+				memcpy(image + pos + i, &fill, min(4u, n - i));
+		} else if (kind == 3) {
+			type = SPARSE_CHUNK_DONT_CARE;
+			memset(image + pos, SPARSE_UNTOUCHED, n);
+		} else {
+			type = SPARSE_CHUNK_RAW;
+			for (i = 0; i < n; i++)
+				image[pos + i] = rand();
+		}
+
+		if (c >= chunks && c->type == type &&
+				(type != SPARSE_CHUNK_FILL || c->fill == fill)) {
+			c->length += n;
+			continue;
+		}
+		c++;
+		c->type = type;
+		c->reserved = 0;
+		c->length = n;
+		c->fill = (type == SPARSE_CHUNK_FILL) ? fill : 0;
+	}
+	return c - chunks + 1;
+}
+
+static int sparse_load(u8 *target, u32 length)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	struct sparse_chunk *chunks;
+	u8 *image, batch[SPARSE_MAX_CHUNKS * sizeof(*chunks) + 1];
+	unsigned int count, i, n, packets = 0, polls;
+	u32 cmd[2], pos = 0, size, wire = 0, raw = 0, crc = 0;
+	struct sample a, b;
+	int ret = 0;
+
+	image = malloc(length);
+	chunks = malloc((length / SPARSE_BLOCK + 1) * sizeof(*chunks));
+	if (!image || !chunks)
+		return -1;
+	count = sparse_image(image, length, chunks);
+	memset(target, SPARSE_UNTOUCHED, length);
+
+	cmd[0] = (u32)(unsigned long) target;
+	cmd[1] = length;
+	sample(&a);
+	if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, LOAD_SPARSE_COMMAND, 0, cmd, sizeof(cmd)) < 0) {
+		fprintf(stderr, "LOAD_SPARSE command stalled\n");
+		ret = -1;
+		goto out;
+	}
+
+	/* header batches end at a RAW chunk, whose data follows alone */
+	for (i = 0; i < count; ) {
+		for (n = 0; n < SPARSE_MAX_CHUNKS && i < count; ) {
+			memcpy(batch + n * sizeof(*chunks), &chunks[i],
+					sizeof(*chunks));
+			n++;
+			if (chunks[i++].type == SPARSE_CHUNK_RAW)
+				break;
+		}
+		size = n * sizeof(*chunks);
+		if (!(size % mps) && n != SPARSE_MAX_CHUNKS)
+			batch[size++] = 0;
+		wire += size;
+		if (send(batch, size, &packets))
+			goto stalled;
+
+		for (; n; n--)
+			pos += chunks[i - n].length;
+		if (chunks[i - 1].type != SPARSE_CHUNK_RAW)
+			continue;
+
+		size = chunks[i - 1].length;
+		crc = ref_crc32(crc, image + pos - size, size);
+		raw += size;
+		wire += size;
+		if (send(image + pos - size, size, &packets))
+			goto stalled;
+	}
+	for (polls = 0; (sim_ep_out_busy(1) || polls < 4) &&
+			polls < MAX_POLLS; polls++)
+		poll();
+	sample(&b);
+	report("SPARSE LOAD (EP1 packet)", packets, mps, &a, &b);
+
+	printf("\nSPARSE: %u chunks, %u bytes on the wire for %u (%.1f%%), "
+			"%.3f output bytes/MMIO, %.1f MiB/s output rate\n",
+			count, wire, length, 100.0 * wire / length,
+			(double) length / (mmio(&a, &b) ? mmio(&a, &b) : 1),
+			length / (elapsed_ns(&a, &b) / 1e9) / (1 << 20));
+
+	if (memcmp(target, image, length)) {
+		fprintf(stderr, "LOAD_SPARSE output mismatch\n");
+		ret = -1;
+	}
+	if (load_crc(crc, raw))
+		ret = -1;
+	goto out;
+
+stalled:
+	fprintf(stderr, "LOAD_SPARSE stalled\n");
+	ret = -1;
+out:
+	free(chunks);
+	free(image);
+	return ret;
+}
+
+static int bulk_submit(u8 command, u32 tag, const void *data, u32 len,
+		unsigned int *packets)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	u32 frame[(BULK_HEADER_SIZE + BULK_PAYLOAD_MAX) / 4 + 1];
+	struct bulk_header *hdr = (struct bulk_header *) frame;
+	u32 total = sizeof(*hdr) + len;
+
+	hdr->magic = BULK_COMMAND_MAGIC;
+	hdr->tag = tag;
+	hdr->length = len;
+	hdr->command = command;
+	hdr->status = 0;
+	hdr->reserved = 0;
+	memcpy(hdr + 1, data, len);
+
+	/* a transfer of whole packets would not end */
+	if (!(total % mps))
+		((u8 *) frame)[total++] = 0;
+	return send((u8 *) frame, total, packets);
+}
+
+/* the status frame of @tag, its payload copied to @data */
+static int bulk_status(u32 tag, void *data, u32 len)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	u32 frame[(BULK_HEADER_SIZE + BULK_PAYLOAD_MAX) / 4];
+	struct bulk_header *hdr = (struct bulk_header *) frame;
+	u32 received = 0;
+	unsigned long polls;
+	int n;
+
+	for (polls = 0; polls < MAX_POLLS * 1000; polls++) {
+		n = sim_ep_in(2, (u8 *) frame + received,
+				sizeof(frame) - received);
+		if (n < 0) {
+			poll();
+			continue;
+		}
+		received += n;
+		if ((unsigned int) n < mps)
+			break;
+	}
+
+	if (received < sizeof(*hdr) || hdr->magic != BULK_STATUS_MAGIC ||
+			hdr->tag != tag || hdr->status ||
+			hdr->length != received - sizeof(*hdr) ||
+			hdr->length != len) {
+		fprintf(stderr, "bad status frame for tag %u: %u bytes, "
+				"status %u\n", tag, received, hdr->status);
+		return -1;
+	}
+	memcpy(data, hdr + 1, len);
+	return 0;
+}
+
+/*
+ * The same LOAD_CRC queries over EP0 and as frames with BULK_DEPTH in
+ * flight, then LOAD segments with their data behind each frame.
+ */
+static int bulk_commands(u8 *target, u32 length)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	unsigned int i, packets = 0, frames = 0, done = 0;
+	u32 crc[3], cmd[2], sent, seg_len;
+	struct sample a, b;
+	u8 *image;
+	int ret = 0;
+
+	sample(&a);
+	for (i = 0; i < BULK_QUERIES; i++)
+		if (control(USB_DIR_IN | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+				0x40, LOAD_CRC_COMMAND, 0, crc,
+				sizeof(crc)) != sizeof(crc))
+			return -1;
+	sample(&b);
+	report("VENDOR LOAD_CRC (EP0)", BULK_QUERIES, sizeof(crc), &a, &b);
+
+	if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, BULK_COMMAND, 1, NULL, 0) < 0) {
+		fprintf(stderr, "BULK command stalled\n");
+		return -1;
+	}
+
+	sample(&a);
+	for (i = 0; i < BULK_QUERIES; i++) {
+		if (i >= BULK_DEPTH && bulk_status(i - BULK_DEPTH, crc,
+				sizeof(crc)))
+			return -1;
+		if (bulk_submit(LOAD_CRC_COMMAND, i, NULL, 0, &packets)) {
+			fprintf(stderr, "bulk frame not taken\n");
+			return -1;
+		}
+	}
+	for (i = BULK_QUERIES - BULK_DEPTH; i < BULK_QUERIES; i++)
+		if (bulk_status(i, crc, sizeof(crc)))
+			return -1;
+	sample(&b);
+	report("BULK LOAD_CRC (frame)", BULK_QUERIES, sizeof(crc), &a, &b);
+
+	image = malloc(length);
+	if (!image)
+		return -1;
+	srand(length + 1);
+	for (sent = 0; sent < length; sent++)
+		image[sent] = rand();
+	memset(target, 0, length);
+
+	/* frames wait behind the data, statuses are collected as they come */
+	seg_len = (length / segments + mps - 1) / mps * mps;
+	packets = 0;
+	sample(&a);
+	for (sent = 0; sent < length; sent += seg_len, frames++) {
+		cmd[0] = (u32)(unsigned long) (target + sent);
+		cmd[1] = min(seg_len, length - sent);
+		if (frames - done == BULK_DEPTH &&
+				bulk_status(done++, NULL, 0))
+			goto failed;
+		if (bulk_submit(LOAD_COMMAND, frames, cmd, sizeof(cmd),
+				&packets) ||
+				send(image + sent, cmd[1], &packets))
+			goto stalled;
+	}
+	for (; done < frames; done++)
+		if (bulk_status(done, NULL, 0))
+			goto failed;
+	if (bulk_submit(LOAD_CRC_COMMAND, frames, NULL, 0, &packets))
+		goto stalled;
+	for (i = 0; i < MAX_POLLS; i++)
+		poll();
+	if (bulk_status(frames, crc, sizeof(crc)))
+		goto failed;
+	sample(&b);
+	report("BULK LOAD (packet)", packets, mps, &a, &b);
+
+	printf("\nEP1: %.1f MiB/s simulated host rate with %u LOAD frames\n",
+			length / (elapsed_ns(&a, &b) / 1e9) / (1 << 20),
+			frames);
+	printf("LOAD CRC-32 %08x over %u bytes\n", crc[0], crc[1]);
+	if (crc[2] || crc[1] != length ||
+			crc[0] != ref_crc32(0, image, length) ||
+			memcmp(target, image, length)) {
+		fprintf(stderr, "BULK LOAD mismatch\n");
+		ret = -1;
+	}
+
+	/* EP1 carries the frames, control OUT commands are refused */
+	if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, LOAD_COMMAND, 0, cmd, sizeof(cmd)) >= 0) {
+		fprintf(stderr, "control LOAD accepted in bulk mode\n");
+		ret = -1;
+	}
+	if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, BULK_COMMAND, 0, NULL, 0) < 0) {
+		fprintf(stderr, "BULK off stalled\n");
+		ret = -1;
+	}
+	free(image);
+	return ret;
+
+stalled:
+	fprintf(stderr, "bulk frame not taken\n");
+failed:
+	free(image);
+	return -1;
+}
+
+static int nand_wait(u32 *status, u32 pages)
+{
+	unsigned long polls;
+
+	status[0] = pages;
+	for (polls = 0; status[0] && polls < MAX_POLLS * 1000; polls++) {
+		poll();
+		if (control(USB_DIR_IN | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+				0x40, NAND_STATUS_COMMAND, 0, status,
+				3 * sizeof(u32)) != 3 * sizeof(u32))
+			return -1;
+	}
+	return status[0] ? -1 : 0;
+}
+
+static int nand_program(const u8 *image, u32 pages)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	u32 length = pages * NAND_PAGE_SIZE;
+	u32 cmd[2] = { 0, pages }, status[3];
+	unsigned int syn[BCH_SYN_WORDS];
+	struct sample a, b;
+	const u8 *raw;
+	u32 sent, chunk, page, packets = 0;
+	unsigned long polls;
+	int i, ret = 0;
+
+	nand_sim_init(pages, NAND_READ_US, NAND_PROG_US, NAND_ERASE_US);
+
+	sample(&a);
+	if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, NAND_PROGRAM_COMMAND, 0, cmd, sizeof(cmd)) < 0) {
+		fprintf(stderr, "NAND PROGRAM command stalled\n");
+		return -1;
+	}
+
+	/* the device NAKs while both page buffers are busy */
+	sent = 0;
+	for (polls = 0; sent < length && polls < MAX_POLLS * 1000; polls++) {
+		chunk = min(length - sent, mps);
+		while (sent < length && sim_ep_out(1, image + sent, chunk)) {
+			sent += chunk;
+			packets++;
+			polls = 0;
+			chunk = min(length - sent, mps);
+		}
+		poll();
+	}
+
+	nand_wait(status, pages);
+	sample(&b);
+	report("NAND PROGRAM (page)", pages, NAND_PAGE_SIZE, &a, &b);
+
+	printf("\nNAND: %.1f MiB/s, %.1f%% of the time the chip was busy, "
+			"%lu erases\n",
+			length / (elapsed_ns(&a, &b) / 1e9) / (1 << 20),
+			100 * nand_sim_stats.busy_ns / elapsed_ns(&a, &b),
+			nand_sim_stats.erases);
+
+	if (status[0] || status[1] != ~0u) {
+		fprintf(stderr, "NAND PROGRAM did not finish, %u pages left, "
+				"failed page %d\n", status[0], (int) status[1]);
+		ret = -1;
+	}
+
+	for (page = 0; page < pages && !ret; page++) {
+		raw = nand_sim_page(page);
+		if (memcmp(raw, image + page * NAND_PAGE_SIZE,
+				NAND_PAGE_SIZE)) {
+			fprintf(stderr, "NAND page %u data mismatch\n", page);
+			ret = -1;
+		}
+		for (i = 0; i < NAND_SECTORS; i++) {
+			if (bch_calculate_syndromes(raw + i * 512, 512,
+					raw + NAND_PAGE_SIZE + NAND_ECC_POS +
+					i * BCH_ECC_BYTES, syn)) {
+				fprintf(stderr, "NAND page %u sector %d ECC "
+						"mismatch\n", page, i);
+				ret = -1;
+			}
+		}
+	}
+	return ret;
+}
+
+/* an unaligned start and a bad block must fail before anything is erased */
+static int nand_refuse(const u8 *image)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	u32 pages = 2 * NAND_PAGES_PER_BLOCK;
+	u32 cmd[2] = { 1, 1 }, status[3];
+	u32 sent = 0, length = (NAND_PAGES_PER_BLOCK + 1) * NAND_PAGE_SIZE;
+	unsigned long polls;
+
+	nand_sim_init(pages, NAND_READ_US, NAND_PROG_US, NAND_ERASE_US);
+
+	if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, NAND_PROGRAM_COMMAND, 0, cmd, sizeof(cmd)) < 0 ||
+			nand_wait(status, 1) || status[1] != 1 ||
+			nand_sim_stats.erases) {
+		fprintf(stderr, "unaligned NAND PROGRAM not refused\n");
+		return -1;
+	}
+	control(USB_RECIP_ENDPOINT, USB_REQ_CLEAR_FEATURE, USB_ENDPOINT_HALT,
+			1, NULL, 0);
+
+	nand_sim_page(NAND_PAGES_PER_BLOCK)[NAND_PAGE_SIZE] = 0;
+	cmd[0] = 0;
+	cmd[1] = pages;
+	if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, NAND_PROGRAM_COMMAND, 0, cmd, sizeof(cmd)) < 0)
+		return -1;
+
+	/* the first page of the second block is taken, then refused */
+	for (polls = 0; sent < length && polls < MAX_POLLS * 1000; polls++) {
+		while (sent < length && sim_ep_out(1, image + sent, mps)) {
+			sent += mps;
+			polls = 0;
+		}
+		poll();
+	}
+	if (nand_wait(status, pages) || status[1] != NAND_PAGES_PER_BLOCK ||
+			nand_sim_stats.erases != 1) {
+		fprintf(stderr, "bad NAND block not refused, %u left, failed page %d, "
+				"%lu erases\n", status[0], (int) status[1],
+				nand_sim_stats.erases);
+		return -1;
+	}
+	control(USB_RECIP_ENDPOINT, USB_REQ_CLEAR_FEATURE, USB_ENDPOINT_HALT,
+			1, NULL, 0);
+
+	printf("\nNAND: unaligned start and bad block refused\n");
+	return 0;
+}
+
+static int nand_dump(const u8 *image, u32 pages)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	u32 length = pages * NAND_PAGE_SIZE;
+	u32 cmd[2] = { 0, pages }, status[3];
+	unsigned long polls, flips = 0;
+	struct sample a, b;
+	u32 received = 0, page, bit;
+	u8 *raw, *out;
+	int i, n, len, ret = 0;
+
+	/* up to BCH_MAX_ERRORS bit flips per sector, data or parity */
+	srand(pages);
+	for (page = 0; page < pages; page++) {
+		raw = nand_sim_page(page);
+		for (i = 0; i < NAND_SECTORS; i++) {
+			for (n = rand() % (BCH_MAX_ERRORS + 1); n; n--) {
+				bit = rand() % (8 * 512 + 52);
+				if (bit < 8 * 512)
+					raw[i * 512 + bit / 8] ^= 1 << (bit % 8);
+				else
+					raw[NAND_PAGE_SIZE + NAND_ECC_POS +
+						i * BCH_ECC_BYTES +
+						(bit - 8 * 512) / 8] ^=
+						0x80 >> (bit % 8);
+				flips++;
+			}
+		}
+	}
+
+	out = malloc(length + mps);
+	if (!out)
+		return -1;
+
+	sample(&a);
+	if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, NAND_DUMP_COMMAND, 0, cmd, sizeof(cmd)) < 0) {
+		fprintf(stderr, "NAND DUMP command stalled\n");
+		free(out);
+		return -1;
+	}
+
+	for (polls = 0; received < length && polls < MAX_POLLS * 1000;
+			polls++) {
+		while ((len = sim_ep_in(2, out + received, mps)) >= 0) {
+			received += len;
+			polls = 0;
+		}
+		poll();
+	}
+	nand_wait(status, pages);
+	sample(&b);
+	report("NAND DUMP (page)", pages, NAND_PAGE_SIZE, &a, &b);
+
+	printf("\nNAND: %.1f MiB/s, %lu bit flips injected, %u corrected\n",
+			length / (elapsed_ns(&a, &b) / 1e9) / (1 << 20),
+			flips, status[2]);
+
+	if (received != length || memcmp(out, image, length)) {
+		fprintf(stderr, "NAND DUMP data mismatch, %u of %u bytes\n",
+				received, length);
+		ret = -1;
+	}
+	/* flips landing on the same bit twice cancel out */
+	if (status[1] != ~0u || status[2] > flips) {
+		fprintf(stderr, "NAND DUMP failed page %d, %u corrected\n",
+				(int) status[1], status[2]);
+		ret = -1;
+	}
+	free(out);
+	return ret;
+}
+
+/*
+ * Start a transfer with the vendor @command, send @sent bytes of its
+ * @data and reset the bus, as a host that gives up or is unplugged would.
+ * The device must drop the transfer and take new ones once enumerated.
+ */
+static int reset_midway(u16 command, void *cmd, u16 len, const u8 *data,
+		u32 sent)
+{
+	unsigned int mps = high_speed ? 512 : 64;
+	unsigned int polls;
+	u16 status = 0;
+	u32 pos = 0;
+
+	if (control(USB_DIR_OUT | USB_TYPE_VENDOR | USB_RECIP_DEVICE,
+			0x40, command, 0, cmd, len) < 0) {
+		fprintf(stderr, "command %u stalled before the reset\n",
+				command);
+		return -1;
+	}
+	for (polls = 0; pos < sent && polls < MAX_POLLS; polls++) {
+		while (pos < sent && sim_ep_out(1, data + pos, mps))
+			pos += mps;
+		poll();
+	}
+	for (polls = 0; polls < 4; polls++)
+		poll();
+
+	sim_bus_reset(high_speed);
+	udc_task();
+	control(USB_DIR_OUT, USB_REQ_SET_ADDRESS, 1, 0, NULL, 0);
+	control(USB_DIR_OUT, USB_REQ_SET_CONFIGURATION, 1, 0, NULL, 0);
+	for (polls = 0; polls < 4; polls++)
+		poll();
+
+	/* a stall here would fail the host's next command */
+	if (control(USB_DIR_IN | USB_RECIP_ENDPOINT, USB_REQ_GET_STATUS, 0,
+			1, &status, sizeof(status)) != sizeof(status) ||
+			status) {
+		fprintf(stderr, "EP1 halted after a bus reset during "
+				"command %u\n", command);
+		return -1;
+	}
+	printf("bus reset during command %u\n\n", command);
+	return 0;
+}
+
+static int reset_loads(u8 *target, u32 length)
+{
+	u32 cmd[2] = { (u32)(unsigned long) target, length };
+
+	if (reset_midway(LOAD_LZ4_COMMAND, cmd, sizeof(cmd), NULL, 0) ||
+			load(target, length))
+		return -1;
+	printf("\n");
+	if (lz4_load(target, length))
+		return -1;
+	printf("\n");
+
+	if (reset_midway(LOAD_SPARSE_COMMAND, cmd, sizeof(cmd), NULL, 0) ||
+			load(target, length))
+		return -1;
+	printf("\n");
+	return sparse_load(target, length);
+}
+
+/* two pages in, so the reset lands while the chip programs */
+static int reset_program(const u8 *image, u32 pages)
+{
+	u32 cmd[2] = { 0, pages };
+
+	nand_sim_init(pages, NAND_READ_US, NAND_PROG_US, NAND_ERASE_US);
+	return reset_midway(NAND_PROGRAM_COMMAND, cmd, sizeof(cmd), image,
+			2 * NAND_PAGE_SIZE);
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-f] [-s size_kib] [-c cycles_per_mmio] "
+			"[-o dest_offset] [-n load_segments] [-z] [-S] "
+			"[-G sg_segments] [-B] [-R] "
+			"[-p nand_pages [-d]]\n",
+			prog);
+	exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned long size = 4096;
+	u8 *target, *image;
+	unsigned int i;
+	int opt, ret;
+
+	while ((opt = getopt(argc, argv, "fs:c:o:n:zSG:BRp:d")) != -1) {
+		switch (opt) {
+		case 'f':
+			high_speed = false;
+			break;
+		case 's':
+			size = strtoul(optarg, NULL, 0);
+			break;
+		case 'c':
+			mmio_cycles = strtoul(optarg, NULL, 0);
+			break;
+		case 'o':
+			offset = strtoul(optarg, NULL, 0) & 15;
+			break;
+		case 'n':
+			segments = strtoul(optarg, NULL, 0) ? : 1;
+			break;
+		case 'z':
+			lz4_load_image = true;
+			break;
+		case 'S':
+			sparse_load_image = true;
+			break;
+		case 'G':
+			sg_segments = strtoul(optarg, NULL, 0);
+			if (sg_segments > LOAD_SG_MAX)
+				usage(argv[0]);
+			break;
+		case 'B':
+			bulk_frames = true;
+			break;
+		case 'R':
+			bus_resets = true;
+			break;
+		case 'p':
+			nand_pages = strtoul(optarg, NULL, 0);
+			break;
+		case 'd':
+			nand_dump_pages = true;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	size *= 1024;
+
+	/* LOAD carries a 32-bit address, keep the target below 4 GiB */
+	target = mmap(NULL, size + 16, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	if (target == MAP_FAILED) {
+		perror("mmap");
+		return 1;
+	}
+
+	sim_reset();
+	udc_init(&udc_driver);
+	sim_vbus(true);
+	sim_bus_reset(high_speed);
+	udc_task();
+
+	printf("%s speed, %lu KiB payload at offset %u, "
+			"%u cycles per MMIO access\n\n",
+			high_speed ? "high" : "full", size / 1024, offset,
+			mmio_cycles);
+	printf("%-24s %6s %9s %9s %9s %9s %9s\n", "transfer", "count",
+			"bytes", "mmio/x", "fifo/x", "cycles/x", "ns/x");
+
+	enumerate();
+	ret = missing_endpoint();
+	if (!ret)
+		ret = load(target + offset, size);
+	if (!ret && lz4_load_image) {
+		printf("\n");
+		ret = lz4_load(target + offset, size);
+	}
+	if (!ret && sparse_load_image) {
+		printf("\n");
+		ret = sparse_load(target + offset, size);
+	}
+	if (!ret && sg_segments) {
+		printf("\n");
+		ret = sg_load(target + offset, size);
+	}
+	if (!ret && bulk_frames) {
+		printf("\n");
+		ret = bulk_commands(target + offset, size);
+	}
+	if (!ret && bus_resets) {
+		printf("\n");
+		ret = reset_loads(target + offset, size);
+	}
+	if (!ret && nand_pages) {
+		image = malloc(nand_pages * NAND_PAGE_SIZE);
+		if (!image)
+			return 1;
+		srand(nand_pages);
+		for (i = 0; i < nand_pages * NAND_PAGE_SIZE; i++)
+			image[i] = rand();
+
+		printf("\n");
+		if (bus_resets)
+			ret = reset_program(image, nand_pages);
+		if (!ret)
+			ret = nand_program(image, nand_pages);
+		if (!ret && nand_dump_pages) {
+			printf("\n");
+			ret = nand_dump(image, nand_pages);
+		}
+		if (!ret && nand_pages >= 2 * NAND_PAGES_PER_BLOCK)
+			ret = nand_refuse(image);
+		free(image);
+	}
+
+	munmap(target, size + 16);
+	return ret ? 1 : 0;
+}
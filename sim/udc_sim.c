@@ -0,0 +1,398 @@
+/*
+ * Host-side Pollux UDC register simulator
+ *
+ * Every readw()/writew() issued by the UDC stack lands here.  Accesses
+ * inside the UDC window are decoded against a model of the controller's
+ * indexed endpoint registers and dual packet buffers; anything else reads
+ * as zero.  The host side of the bus is driven through the sim_*() calls
+ * declared in udc_sim.h.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "asm/io.h"
+#include "asm/types.h"
+#include "mach/udc.h"
+
+#include "nand_sim.h"
+#include "udc_sim.h"
+
+#define SIM_NUM_EP      16
+#define SIM_PKT_MAX     1024
+#define SIM_RX_BUFS     2
+#define SIM_TX_BUFS     64
+
+struct sim_pkt {
+	u16			words[SIM_PKT_MAX / 2];
+	unsigned int		len;
+	unsigned int		pos;
+};
+
+struct sim_ep {
+	struct sim_pkt		rx[SIM_RX_BUFS];
+	unsigned int		rx_head;
+	unsigned int		rx_count;
+
+	struct sim_pkt		tx[SIM_TX_BUFS];
+	unsigned int		tx_head;
+	unsigned int		tx_count;
+	struct sim_pkt		tx_fill;
+	unsigned int		bwcr;
+
+	u16			status;
+	u16			ecr;
+	u16			mpr;
+};
+
+static struct {
+	u16			regs[UDC_SIZE / 2];
+	u16			index;
+	u16			eir;
+	u16			ssr;
+	bool			vbus;
+	struct sim_ep		ep[SIM_NUM_EP];
+} sim;
+
+struct sim_stats sim_stats;
+
+static inline struct sim_ep *cur_ep(void)
+{
+	return &sim.ep[sim.index & (SIM_NUM_EP - 1)];
+}
+
+static inline struct sim_pkt *rx_pkt(struct sim_ep *ep)
+{
+	return ep->rx_count ? &ep->rx[ep->rx_head] : NULL;
+}
+
+static void rx_pop(int epnum)
+{
+	struct sim_ep *ep = &sim.ep[epnum];
+
+	if (!ep->rx_count)
+		return;
+
+	ep->rx_head = (ep->rx_head + 1) % SIM_RX_BUFS;
+	ep->rx_count--;
+
+	/* the next buffered packet raises its own interrupt */
+	if (ep->rx_count)
+		sim.eir |= 1 << epnum;
+}
+
+static void tx_commit(int epnum)
+{
+	struct sim_ep *ep = &sim.ep[epnum];
+	struct sim_pkt *pkt;
+
+	if (ep->tx_count < SIM_TX_BUFS) {
+		pkt = &ep->tx[(ep->tx_head + ep->tx_count) % SIM_TX_BUFS];
+		memcpy(pkt, &ep->tx_fill, sizeof(*pkt));
+		pkt->len = ep->bwcr;
+		pkt->pos = 0;
+		ep->tx_count++;
+	}
+
+	/* the host acknowledges immediately */
+	ep->tx_fill.pos = 0;
+	ep->status |= epnum ? UDC_ESR_TX_SUCCESS : UDC_EP0SR_TX_SUCCESS;
+	sim.eir |= 1 << epnum;
+}
+
+static u16 ep_status(int epnum)
+{
+	struct sim_ep *ep = &sim.ep[epnum];
+	struct sim_pkt *pkt = rx_pkt(ep);
+	u16 status = ep->status;
+
+	if (pkt) {
+		status |= UDC_ESR_RX_SUCCESS;
+		if (pkt->len & 1)
+			status |= epnum ? UDC_ESR_LWO : UDC_EP0SR_EP0_LWO;
+		if (epnum)
+			status |= (ep->rx_count > 1) ? UDC_ESR_PSIF_TWO :
+					UDC_ESR_PSIF_ONE;
+	}
+	return status;
+}
+
+static u16 sim_read(unsigned int offset)
+{
+	struct sim_pkt *pkt;
+	int epnum;
+
+	if (offset >= UDC_BR(0) && offset < UDC_BR(SIM_NUM_EP)) {
+		epnum = (offset - UDC_BR(0)) / 2;
+		pkt = rx_pkt(&sim.ep[epnum]);
+		sim_stats.fifo_reads++;
+		if (!pkt || pkt->pos >= (pkt->len + 1) / 2)
+			return 0;
+		if (++pkt->pos == (pkt->len + 1) / 2 && epnum)
+			rx_pop(epnum);
+		return pkt->words[pkt->pos - 1];
+	}
+
+	switch (offset) {
+	case UDC_IR:
+		return sim.index;
+	case UDC_EIR:
+		return sim.eir;
+	case UDC_SSR:
+		return sim.ssr;
+	case UDC_TR:
+		return sim.vbus ? UDC_TR_VBUS : 0;
+	case UDC_EP0SR:
+		return ep_status(0);
+	case UDC_EP0CR:
+		return sim.ep[0].ecr;
+	case UDC_ESR:
+		return ep_status(sim.index);
+	case UDC_ECR:
+		return cur_ep()->ecr;
+	case UDC_MPR:
+		return cur_ep()->mpr;
+	case UDC_BRCR:
+		pkt = rx_pkt(cur_ep());
+		return pkt ? (pkt->len + 1) / 2 - pkt->pos : 0;
+	case UDC_BWCR:
+		return cur_ep()->bwcr;
+	}
+
+	return sim.regs[offset / 2];
+}
+
+static void sim_write(unsigned int offset, u16 val)
+{
+	struct sim_ep *ep;
+	int epnum;
+
+	if (offset >= UDC_BR(0) && offset < UDC_BR(SIM_NUM_EP)) {
+		epnum = (offset - UDC_BR(0)) / 2;
+		ep = &sim.ep[epnum];
+		sim_stats.fifo_writes++;
+		if (ep->tx_fill.pos < SIM_PKT_MAX / 2)
+			ep->tx_fill.words[ep->tx_fill.pos++] = val;
+		if (ep->tx_fill.pos * 2 >= ep->bwcr)
+			tx_commit(epnum);
+		return;
+	}
+
+	switch (offset) {
+	case UDC_IR:
+		sim.index = val & (SIM_NUM_EP - 1);
+		return;
+	case UDC_EIR:
+		sim.eir &= ~val;
+		return;
+	case UDC_SSR:
+		sim.ssr &= ~val;
+		return;
+	case UDC_EP0SR:
+		ep = &sim.ep[0];
+		if (val & UDC_EP0SR_RX_SUCCESS && ep->rx_count) {
+			ep->rx_count = 0;
+			ep->rx_head = 0;
+		}
+		ep->status &= ~(val & (UDC_EP0SR_TX_SUCCESS |
+				UDC_EP0SR_STALL));
+		return;
+	case UDC_EP0CR:
+		sim.ep[0].ecr = val;
+		return;
+	case UDC_ESR:
+		cur_ep()->status &= ~(val & (UDC_ESR_TX_SUCCESS |
+				UDC_ESR_STALL));
+		return;
+	case UDC_ECR:
+		ep = cur_ep();
+		if (val & UDC_ECR_FLUSH) {
+			ep->rx_count = 0;
+			ep->tx_fill.pos = 0;
+			val &= ~UDC_ECR_FLUSH;
+		}
+		ep->ecr = val;
+		return;
+	case UDC_MPR:
+		cur_ep()->mpr = val;
+		return;
+	case UDC_BWCR:
+		ep = cur_ep();
+		ep->bwcr = val;
+		ep->tx_fill.pos = 0;
+		if (!val)
+			tx_commit(sim.index);
+		return;
+	}
+
+	sim.regs[offset / 2] = val;
+}
+
+static inline long udc_offset(const volatile void *addr)
+{
+	long offset = (long)(unsigned long) addr - UDC_BASE;
+
+	return (offset >= 0 && offset < UDC_SIZE) ? offset : -1;
+}
+
+u16 readw(const volatile void __iomem *addr)
+{
+	long offset = udc_offset(addr);
+
+	sim_stats.reads++;
+	return (offset >= 0) ? sim_read(offset) : 0;
+}
+
+void writew(u16 val, volatile void __iomem *addr)
+{
+	long offset = udc_offset(addr);
+
+	sim_stats.writes++;
+	if (offset >= 0)
+		sim_write(offset, val);
+}
+
+static inline long nand_offset(const volatile void *addr)
+{
+	long offset = (long)(unsigned long) addr - NAND_SIM_BASE;
+
+	return (offset >= 0 && offset < NAND_SIM_SIZE) ? offset : -1;
+}
+
+u8 readb(const volatile void __iomem *addr)
+{
+	long offset = nand_offset(addr);
+
+	if (offset >= 0) {
+		sim_stats.reads++;
+		return nand_sim_read(offset);
+	}
+	return readw(addr);
+}
+
+u32 readl(const volatile void __iomem *addr)
+{
+	return readw(addr);
+}
+
+void writeb(u8 val, volatile void __iomem *addr)
+{
+	long offset = nand_offset(addr);
+
+	if (offset >= 0) {
+		sim_stats.writes++;
+		nand_sim_write(offset, val);
+		return;
+	}
+	writew(val, addr);
+}
+
+void writel(u32 val, volatile void __iomem *addr)
+{
+	writew(val, addr);
+}
+
+void sim_reset(void)
+{
+	memset(&sim, 0, sizeof(sim));
+	memset(&sim_stats, 0, sizeof(sim_stats));
+}
+
+void sim_vbus(bool on)
+{
+	sim.vbus = on;
+	sim.ssr |= on ? UDC_SSR_VBUSON : UDC_SSR_VBUSOFF;
+}
+
+void sim_bus_reset(bool high_speed)
+{
+	int epnum;
+
+	for (epnum = 0; epnum < SIM_NUM_EP; epnum++) {
+		sim.ep[epnum].rx_count = 0;
+		sim.ep[epnum].tx_count = 0;
+		sim.ep[epnum].status = 0;
+	}
+	sim.ssr |= UDC_SSR_RESET | UDC_SSR_SDE;
+	if (high_speed)
+		sim.ssr |= UDC_SSR_HSP;
+}
+
+void sim_ep0_setup(const void *setup)
+{
+	struct sim_ep *ep = &sim.ep[0];
+
+	ep->rx_count = 0;
+	ep->rx_head = 0;
+	sim_ep_out(0, setup, 8);
+}
+
+bool sim_ep0_busy(void)
+{
+	return sim.ep[0].rx_count != 0;
+}
+
+bool sim_ep0_stalled(void)
+{
+	return sim.ep[0].ecr & UDC_ECR_STALL;
+}
+
+void sim_ep0_clear_stall(void)
+{
+	sim.ep[0].status |= UDC_EP0SR_STALL;
+	sim.eir |= UDC_EP0;
+}
+
+bool sim_ep_out(int epnum, const void *data, unsigned int len)
+{
+	struct sim_ep *ep = &sim.ep[epnum];
+	struct sim_pkt *pkt;
+
+	if (ep->rx_count >= (epnum ? SIM_RX_BUFS : 1) || len > SIM_PKT_MAX)
+		return false;
+
+	pkt = &ep->rx[(ep->rx_head + ep->rx_count) % SIM_RX_BUFS];
+	memset(pkt->words, 0, sizeof(pkt->words));
+	memcpy(pkt->words, data, len);
+	pkt->len = len;
+	pkt->pos = 0;
+	ep->rx_count++;
+
+	sim.eir |= 1 << epnum;
+	return true;
+}
+
+bool sim_ep_out_busy(int epnum)
+{
+	return sim.ep[epnum].rx_count != 0;
+}
+
+int sim_ep_in(int epnum, void *data, unsigned int max)
+{
+	struct sim_ep *ep = &sim.ep[epnum];
+	struct sim_pkt *pkt;
+	unsigned int len;
+
+	if (!ep->tx_count)
+		return -1;
+
+	pkt = &ep->tx[ep->tx_head];
+	len = (pkt->len < max) ? pkt->len : max;
+	memcpy(data, pkt->words, len);
+	ep->tx_head = (ep->tx_head + 1) % SIM_TX_BUFS;
+	ep->tx_count--;
+	return len;
+}
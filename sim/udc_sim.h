@@ -0,0 +1,47 @@
+/*
+ * Host-side Pollux UDC register simulator
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _UDC_SIM_H
+#define _UDC_SIM_H
+
+#include <stdbool.h>
+
+#include "asm/types.h"
+
+struct sim_stats {
+	unsigned long		reads;
+	unsigned long		writes;
+	unsigned long		fifo_reads;
+	unsigned long		fifo_writes;
+};
+
+extern struct sim_stats sim_stats;
+
+void sim_reset(void);
+void sim_vbus(bool on);
+void sim_bus_reset(bool high_speed);
+
+void sim_ep0_setup(const void *setup);
+bool sim_ep0_busy(void);
+bool sim_ep0_stalled(void);
+void sim_ep0_clear_stall(void);
+
+bool sim_ep_out(int epnum, const void *data, unsigned int len);
+bool sim_ep_out_busy(int epnum);
+int sim_ep_in(int epnum, void *data, unsigned int max);
+
+#endif /* _UDC_SIM_H */
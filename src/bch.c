@@ -1,5 +1,5 @@
 /*
- * 4-bit 0x25AF BCH syndrome decoder
+ * Binary BCH syndrome decoder, 4-bit 0x25AF by default
  *
  * This program is free software; you can redistribute it and/or modify it
  * under the terms of the GNU General Public License version 2 as published by
@@ -23,37 +23,82 @@
 #include <stdint.h>
 #include <string.h>
 #include "bch.h"
+#include "stats.h"
+#ifdef CONFIG_BCH_STATIC_TABLES
+#include "bch_tables.h"
+#endif
 
-#define DIV_ROUND_UP(a, b) ((a + b - 1) / b)
+/* code used by the Pollux NAND controller */
+#define POLLUX_M               13
+#define POLLUX_T               BCH_MAX_ERRORS
+#define POLLUX_POLY            0x25AF
 
-#define GF_M                   13
-#define GF_T                   4
-#define GF_N                   8191
+#ifdef CONFIG_BCH_STATIC_TABLES
+static struct bch_control bch_pollux = {
+	.m         = POLLUX_M,
+	.n         = (1 << POLLUX_M) - 1,
+	.t         = POLLUX_T,
+	.ecc_bits  = POLLUX_M * POLLUX_T,
+	.a_pow_tab = bch_a_pow_tab,
+	.a_log_tab = bch_a_log_tab,
+	.xi_tab    = bch_xi_tab,
+};
+#else
+static struct bch_control bch_pollux;
+static uint16_t           pollux_pow_tab[1 << POLLUX_M];
+static uint16_t           pollux_log_tab[1 << POLLUX_M];
+#endif
+
+/*
+ * The decoder is compiled twice from one source.  bch_decode_ctrl() and
+ * bch_decode_page_ctrl() read m, t and the tables from the control block;
+ * bch_decode() and bch_decode_page() get an instance for the built-in
+ * code in which they are constants, so the field arithmetic works on
+ * immediates and the tables are addressed directly.  The decoder stages
+ * are always inlined, and POLLUX() is only true in the copy that was
+ * handed &bch_pollux itself.
+ */
+#define __bch_inline           inline __attribute__((always_inline))
+#define POLLUX(_p)             (__builtin_constant_p((_p) == &bch_pollux) && \
+				(_p) == &bch_pollux)
+
+#ifdef CONFIG_BCH_STATIC_TABLES
+#define POLLUX_POW_TAB         bch_a_pow_tab
+#define POLLUX_LOG_TAB         bch_a_log_tab
+#define POLLUX_XI_TAB          bch_xi_tab
+#else
+#define POLLUX_POW_TAB         pollux_pow_tab
+#define POLLUX_LOG_TAB         pollux_log_tab
+#define POLLUX_XI_TAB          bch_pollux.xi_buf
+#endif
 
-#define BCH_ECC_BITS           (GF_M * GF_T)
-#define BCH_ECC_WORDS          DIV_ROUND_UP(BCH_ECC_BITS, 32)
-#define BCH_ECC_BYTES          DIV_ROUND_UP(BCH_ECC_BITS, 8)
+#define GF_M(_p)               (POLLUX(_p) ? POLLUX_M : (_p)->m)
+#define GF_T(_p)               (POLLUX(_p) ? POLLUX_T : (_p)->t)
+#define GF_N(_p)               (POLLUX(_p) ? (1 << POLLUX_M)-1 : (_p)->n)
+#define ECC_BITS(_p)           (POLLUX(_p) ? POLLUX_M*POLLUX_T : \
+				(_p)->ecc_bits)
+#define A_POW_TAB(_p)          (POLLUX(_p) ? POLLUX_POW_TAB : (_p)->a_pow_tab)
+#define A_LOG_TAB(_p)          (POLLUX(_p) ? POLLUX_LOG_TAB : (_p)->a_log_tab)
+#define XI_TAB(_p)             (POLLUX(_p) ? POLLUX_XI_TAB : (_p)->xi_tab)
 
 /*
- * represent a polynomial over GF(2^m)
+ * Encoder remainder tables: enc_tab[k][b] is b(x).x^(8k).x^ecc_bits mod g(x),
+ * left-aligned in 64 bits so the remainder register needs no masking.
  */
-struct gf_poly {
-	unsigned int deg;       /* polynomial degree */
-	unsigned int c[8];      /* polynomial terms */
-};
+#define ENC_SHIFT              (64 - POLLUX_M*POLLUX_T)
 
-static uint16_t           a_pow_tab[8192];
-static uint16_t           a_log_tab[8192];
-static int                cache[8];
-static struct gf_poly     elp;
-static struct gf_poly     pelp;
-static struct gf_poly     elp_copy;
+#ifdef CONFIG_BCH_STATIC_TABLES
+#define enc_tab                bch_enc_tab
+#else
+static uint64_t           enc_tab[4][256];
+#endif
 
-static inline int modulo(unsigned int v)
+static __bch_inline int modulo(const struct bch_control *bch, unsigned int v)
 {
-	while (v >= GF_N) {
-		v -= GF_N;
-		v = (v & GF_N) + (v >> GF_M);
+	const unsigned int n = GF_N(bch);
+	while (v >= n) {
+		v -= n;
+		v = (v & n) + (v >> GF_M(bch));
 	}
 	return v;
 }
@@ -61,9 +106,10 @@ static inline int modulo(unsigned int v)
 /*
  * shorter and faster modulo function, only works when v < 2N.
  */
-static inline int mod_s(unsigned int v)
+static __bch_inline int mod_s(const struct bch_control *bch, unsigned int v)
 {
-	return (v < GF_N) ? v : v-GF_N;
+	const unsigned int n = GF_N(bch);
+	return (v < n) ? v : v-n;
 }
 
 /* polynomial degree is the most-significant bit index */
@@ -77,117 +123,324 @@ static inline int deg(unsigned int poly)
 
 /* Galois field basic operations: multiply, divide, inverse, etc. */
 
-static inline unsigned int gf_mul(unsigned int a, unsigned int b)
+static __bch_inline unsigned int gf_mul(const struct bch_control *bch,
+		unsigned int a, unsigned int b)
 {
-	return (a && b) ? a_pow_tab[mod_s(a_log_tab[a]+
-					       a_log_tab[b])] : 0;
+	return (a && b) ? A_POW_TAB(bch)[mod_s(bch, A_LOG_TAB(bch)[a]+
+					       A_LOG_TAB(bch)[b])] : 0;
 }
 
-static inline unsigned int gf_sqr(unsigned int a)
+static __bch_inline unsigned int gf_sqr(const struct bch_control *bch,
+		unsigned int a)
 {
-	return a ? a_pow_tab[mod_s(2*a_log_tab[a])] : 0;
+	return a ? A_POW_TAB(bch)[mod_s(bch, 2*A_LOG_TAB(bch)[a])] : 0;
 }
 
-static inline unsigned int gf_div(unsigned int a, unsigned int b)
+static __bch_inline unsigned int gf_div(const struct bch_control *bch,
+		unsigned int a, unsigned int b)
 {
-	return a ? a_pow_tab[mod_s(a_log_tab[a]+GF_N-a_log_tab[b])] : 0;
+	return a ? A_POW_TAB(bch)[mod_s(bch, A_LOG_TAB(bch)[a]+GF_N(bch)-
+				A_LOG_TAB(bch)[b])] : 0;
 }
 
-static inline unsigned int a_pow(int i)
+static __bch_inline unsigned int a_pow(const struct bch_control *bch, int i)
 {
-	return a_pow_tab[modulo(i)];
+	return A_POW_TAB(bch)[modulo(bch, i)];
 }
 
-static inline int a_log(unsigned int x)
+static __bch_inline int a_log(const struct bch_control *bch, unsigned int x)
 {
-	return a_log_tab[x];
+	return A_LOG_TAB(bch)[x];
 }
 
-static int compute_error_locator_polynomial(const unsigned int *syn)
+static __bch_inline int compute_error_locator_polynomial(
+		struct bch_control *bch, const unsigned int *syn)
 {
+	const unsigned int t = GF_T(bch);
+	const unsigned int n = GF_N(bch);
+	struct gf_poly *elp = &bch->elp;
+	struct gf_poly *pelp = &bch->pelp;
+	struct gf_poly *elp_copy = &bch->elp_copy;
+	const size_t size = sizeof(unsigned int)*(2*t+1);
 	unsigned int i, j, tmp, l, pd = 1, d = syn[0];
 	int k, pp = -1;
 
-	memset(&pelp, 0, sizeof(struct gf_poly));
-	memset(&elp, 0, sizeof(struct gf_poly));
+	memset(pelp->c, 0, size);
+	memset(elp->c, 0, size);
 
-	pelp.deg = 0;
-	pelp.c[0] = 1;
-	elp.deg = 0;
-	elp.c[0] = 1;
+	pelp->deg = 0;
+	pelp->c[0] = 1;
+	elp->deg = 0;
+	elp->c[0] = 1;
 
 	/* use simplified binary Berlekamp-Massey algorithm */
-	for (i = 0; (i < GF_T) && (elp.deg <= GF_T); i++) {
+	for (i = 0; (i < t) && (elp->deg <= t); i++) {
 		if (d) {
 			k = 2*i-pp;
-			memcpy(&elp_copy, &elp, sizeof(struct gf_poly));
+			elp_copy->deg = elp->deg;
+			memcpy(elp_copy->c, elp->c, size);
 			/* e[i+1](X) = e[i](X)+di*dp^-1*X^2(i-p)*e[p](X) */
-			tmp = a_log(d)+GF_N-a_log(pd);
-			for (j = 0; j <= pelp.deg; j++) {
-				if (pelp.c[j]) {
-					l = a_log(pelp.c[j]);
-					elp.c[j+k] ^= a_pow(tmp+l);
+			tmp = a_log(bch, d)+n-a_log(bch, pd);
+			for (j = 0; j <= pelp->deg; j++) {
+				if (pelp->c[j]) {
+					l = a_log(bch, pelp->c[j]);
+					elp->c[j+k] ^= a_pow(bch, tmp+l);
 				}
 			}
 			/* compute l[i+1] = max(l[i]->c[l[p]+2*(i-p]) */
-			tmp = pelp.deg+k;
-			if (tmp > elp.deg) {
-				elp.deg = tmp;
-				memcpy(&pelp, &elp_copy, sizeof(struct gf_poly));
+			tmp = pelp->deg+k;
+			if (tmp > elp->deg) {
+				elp->deg = tmp;
+				pelp->deg = elp_copy->deg;
+				memcpy(pelp->c, elp_copy->c, size);
 				pd = d;
 				pp = 2*i;
 			}
 		}
 		/* di+1 = S(2i+3)+elp[i+1].1*S(2i+2)+...+elp[i+1].lS(2i+3-l) */
-		if (i < GF_T-1) {
+		if (i < t-1) {
 			d = syn[2*i+2];
-			for (j = 1; j <= elp.deg; j++)
-				d ^= gf_mul(elp.c[j], syn[2*i+2-j]);
+			for (j = 1; j <= elp->deg; j++)
+				d ^= gf_mul(bch, elp->c[j], syn[2*i+2-j]);
 		}
 	}
-	return (elp.deg > GF_T) ? -1 : (int)elp.deg;
+	return (elp->deg > t) ? -1 : (int)elp->deg;
 }
 
 /*
  * build monic, log-based representation of a polynomial
  */
-static void gf_poly_logrep(const struct gf_poly *a, int *rep)
+static __bch_inline void gf_poly_logrep(const struct bch_control *bch,
+		const struct gf_poly *a, int *rep)
 {
-	int i, d = a->deg, l = GF_N-a_log(a->c[a->deg]);
+	int i, d = a->deg, l = GF_N(bch)-a_log(bch, a->c[a->deg]);
 
 	/* represent 0 values with -1; warning, rep[d] is not set to 1 */
 	for (i = 0; i < d; i++)
-		rep[i] = a->c[i] ? mod_s(a_log(a->c[i])+l) : -1;
+		rep[i] = a->c[i] ? mod_s(bch, a_log(bch, a->c[i])+l) : -1;
+}
+
+/*
+ * compute root r of a degree 1 polynomial over GF(2^m) (returned as log(1/r))
+ */
+static __bch_inline int find_poly_deg1_roots(const struct bch_control *bch,
+		const struct gf_poly *poly, unsigned int *roots)
+{
+	int n = 0;
+
+	if (poly->c[0])
+		/* poly[X] = bX+c with c!=0, root=c/b */
+		roots[n++] = mod_s(bch, GF_N(bch)-a_log(bch, poly->c[0])+
+				   a_log(bch, poly->c[1]));
+	return n;
+}
+
+/*
+ * compute roots of a degree 2 polynomial over GF(2^m)
+ */
+static __bch_inline int find_poly_deg2_roots(const struct bch_control *bch,
+		const struct gf_poly *poly, unsigned int *roots)
+{
+	int n = 0, i, l0, l1, l2;
+	unsigned int u, v, r;
+
+	if (poly->c[0] && poly->c[1]) {
+
+		l0 = a_log(bch, poly->c[0]);
+		l1 = a_log(bch, poly->c[1]);
+		l2 = a_log(bch, poly->c[2]);
+
+		/* using z=a/bX, transform aX^2+bX+c into z^2+z+u (u=ac/b^2) */
+		u = a_pow(bch, l0+l2+2*(GF_N(bch)-l1));
+		/*
+		 * let u = sum(li.a^i) i=0..m-1; then compute r = sum(li.xi):
+		 * r^2+r = sum(li.(xi^2+xi)) = sum(li.a^i) = u
+		 * i.e. r and r+1 are roots iff Tr(u)=0
+		 */
+		r = 0;
+		v = u;
+		while (v) {
+			i = deg(v);
+			r ^= XI_TAB(bch)[i];
+			v ^= (1 << i);
+		}
+		/* verify root */
+		if ((gf_sqr(bch, r)^r) == u) {
+			/* reverse z=a/bX transformation and compute log(1/r) */
+			roots[n++] = modulo(bch, 2*GF_N(bch)-l1-
+					    a_log(bch, r)+l2);
+			roots[n++] = modulo(bch, 2*GF_N(bch)-l1-
+					    a_log(bch, r^1)+l2);
+		}
+	}
+	return n;
 }
 
 /*
- * exhaustive root search (Chien) implementation
+ * exhaustive root search (Chien) implementation, used from degree 3 up
+ *
+ * Each term's log is stepped incrementally from one candidate to the
+ * next instead of being recomputed with a multiply and modulo.
  */
-static int chien_search(unsigned int len, unsigned int *roots)
+static __bch_inline int chien_search(struct bch_control *bch,
+		unsigned int len, unsigned int *roots)
 {
-	int m;
-	unsigned int i, j, syn, syn0, count = 0;
-	const unsigned int k = 8*len+BCH_ECC_BITS;
+	const struct gf_poly *elp = &bch->elp;
+	const unsigned int n = GF_N(bch);
+	const unsigned int k = 8*len+ECC_BITS(bch);
+	const unsigned int d = elp->deg;
+	unsigned int step[BCH_MAX_T], inc[BCH_MAX_T];
+	unsigned int i, j, s, nt = 0, syn, syn0, count = 0;
+	int *cache = bch->cache;
 
 	/* use a log-based representation of polynomial */
-	gf_poly_logrep(&elp, cache);
-	cache[elp.deg] = 0;
-	syn0 = gf_div(elp.c[0], elp.c[elp.deg]);
-
-	for (i = GF_N-k+1; i <= GF_N; i++) {
-		/* compute elp(a^i) */
-		for (j = 1, syn = syn0; j <= elp.deg; j++) {
-			m = cache[j];
-			if (m >= 0)
-				syn ^= a_pow(m+j*i);
+	gf_poly_logrep(bch, elp, cache);
+	cache[d] = 0;
+	syn0 = gf_div(bch, elp->c[0], elp->c[d]);
+
+	/* non-zero terms at the first candidate, a^(m+j*i), i = N-k+1 */
+	for (j = 1; j <= d; j++) {
+		if (cache[j] >= 0) {
+			step[nt] = modulo(bch, cache[j]+j*(n-k+1));
+			inc[nt++] = j;
 		}
+	}
+
+	for (i = n-k+1; i <= n; i++) {
+		/* give up once too few candidates remain */
+		if (n+1-i < d-count)
+			break;
+
+		/* compute elp(a^i), the leading term is never zero */
+		j = 0;
+		syn = syn0;
+		do {
+			s = step[j];
+			syn ^= A_POW_TAB(bch)[s];
+			step[j] = mod_s(bch, s+inc[j]);
+		} while (++j < nt);
 		if (syn == 0) {
-			roots[count++] = GF_N-i;
-			if (count == elp.deg)
+			roots[count++] = n-i;
+			if (count == d)
+				break;
+		}
+	}
+	return (count == d) ? count : 0;
+}
+
+static __bch_inline int find_poly_roots(struct bch_control *bch,
+		unsigned int len, unsigned int *roots)
+{
+	switch (bch->elp.deg) {
+	case 1:
+		return find_poly_deg1_roots(bch, &bch->elp, roots);
+	case 2:
+		return find_poly_deg2_roots(bch, &bch->elp, roots);
+	default:
+		return chien_search(bch, len, roots);
+	}
+}
+
+static __bch_inline int decode_sector(struct bch_control *bch,
+		unsigned int len, unsigned int nbits, unsigned int *syn,
+		unsigned int *errloc)
+{
+	u32 start = stats_start();
+	int i, err, nroots;
+
+	/* v(a^(2j)) = v(a^j)^2 */
+	for (i = 0; i < (int)GF_T(bch); i++)
+		syn[2*i+1] = gf_sqr(bch, syn[i]);
+
+	err = compute_error_locator_polynomial(bch, syn);
+	if (err > 0) {
+		nroots = find_poly_roots(bch, len, errloc);
+		if (err != nroots)
+			err = -1;
+	}
+	if (err > 0) {
+		/* post-process raw error locations for easier correction */
+		for (i = 0; i < err; i++) {
+			if (errloc[i] >= nbits) {
+				err = -1;
 				break;
+			}
+			errloc[i] = nbits-1-errloc[i];
+			errloc[i] = (errloc[i] & ~7)|(7-(errloc[i] & 7));
+		}
+	}
+	stats_time(HIST_BCH_DECODE, start);
+	stats_inc(STAT_BCH_DECODES);
+	if (err >= 0)
+		stats_add(STAT_BCH_CORRECTED, err);
+	else
+		stats_inc(STAT_BCH_FAILED);
+	return (err >= 0) ? err : -1;
+}
+
+static __bch_inline int decode_page(struct bch_control *bch,
+		unsigned int len, unsigned int nsectors, unsigned int *syn,
+		unsigned int *errloc, int *nerr)
+{
+	const unsigned int nbits = (len*8)+ECC_BITS(bch);
+	const unsigned int t = GF_T(bch);
+	unsigned int i, n, s;
+	int total = 0;
+
+	for (n = 0; n < nsectors; n++, syn += 2*t, errloc += t) {
+		for (i = 0, s = 0; i < t; i++)
+			s |= syn[2*i];
+		if (!s) {
+			nerr[n] = 0;
+			continue;
 		}
+
+		nerr[n] = decode_sector(bch, len, nbits, syn, errloc);
+		if (nerr[n] < 0 || total < 0)
+			total = -1;
+		else
+			total += nerr[n];
 	}
-	return (count == elp.deg) ? count : 0;
+	return total;
+}
+
+/**
+ * bch_decode_ctrl - decode received codeword and find bit error locations
+ * @bch:      decoder set up by bch_init_ctrl()
+ * @len:      data length in bytes, must always be provided
+ * @syn:      hw computed syndrome data, 2*t words
+ * @errloc:   output array of error locations, t words
+ *
+ * Returns:
+ *  The number of errors found, or -1 if decoding failed
+ *
+ * Error locations follow the bch_decode() convention.  Each decoder
+ * carries its own scratch state, so different decoders may be used
+ * concurrently.
+ */
+int bch_decode_ctrl(struct bch_control *bch, unsigned int len,
+		unsigned int *syn, unsigned int *errloc)
+{
+	return decode_sector(bch, len, (len*8)+ECC_BITS(bch), syn, errloc);
+}
+
+/**
+ * bch_decode_page_ctrl - decode all sectors of a NAND page
+ * @bch:      decoder set up by bch_init_ctrl()
+ * @len:      sector data length in bytes
+ * @nsectors: number of sectors in the page
+ * @syn:      hw computed syndrome data, 2*t words per sector
+ * @errloc:   output array of error locations, t words per sector
+ * @nerr:     output array of per-sector error counts, -1 if uncorrectable
+ *
+ * Returns:
+ *  The total number of errors found, or -1 if any sector failed
+ */
+int bch_decode_page_ctrl(struct bch_control *bch, unsigned int len,
+		unsigned int nsectors, unsigned int *syn,
+		unsigned int *errloc, int *nerr)
+{
+	return decode_page(bch, len, nsectors, syn, errloc, nerr);
 }
 
 /**
@@ -213,51 +466,267 @@ static int chien_search(unsigned int len, unsigned int *roots)
  */
 int bch_decode(unsigned int len, unsigned int *syn, unsigned int *errloc)
 {
-	unsigned int nbits;
-	int i, err, nroots;
+	return decode_sector(&bch_pollux, len,
+			(len*8)+POLLUX_M*POLLUX_T, syn, errloc);
+}
 
-	/* v(a^(2j)) = v(a^j)^2 */
-	for (i = 0; i < GF_T; i++)
-		syn[2*i+1] = gf_sqr(syn[i]);
+/**
+ * bch_decode_page - decode all sectors of a NAND page
+ * @len:      sector data length in bytes
+ * @nsectors: number of sectors in the page
+ * @syn:      hw computed syndrome data, BCH_SYN_WORDS per sector
+ * @errloc:   output array of error locations, BCH_MAX_ERRORS per sector
+ * @nerr:     output array of per-sector error counts, -1 if uncorrectable
+ *
+ * Returns:
+ *  The total number of errors found, or -1 if any sector failed
+ *
+ * Sectors whose odd syndromes are all zero are clean and skipped without
+ * touching the decoder.  Locations follow the bch_decode() convention,
+ * relative to their own sector.
+ */
+int bch_decode_page(unsigned int len, unsigned int nsectors,
+		unsigned int *syn, unsigned int *errloc, int *nerr)
+{
+	return decode_page(&bch_pollux, len, nsectors, syn, errloc, nerr);
+}
 
-	err = compute_error_locator_polynomial(syn);
-	if (err > 0) {
-		nroots = chien_search(len, errloc);
-		if (err != nroots)
-			err = -1;
+static inline uint32_t load_be32(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 24)|((uint32_t)p[1] << 16)|
+		((uint32_t)p[2] << 8)|p[3];
+}
+
+/*
+ * remainder of data(x).x^ecc_bits mod g(x), four bytes per step
+ */
+static uint64_t encode_rem(const uint8_t *data, unsigned int len)
+{
+	uint64_t rem = 0;
+	uint32_t w;
+
+	while (len >= 4) {
+		w = (uint32_t)(rem >> 32) ^ load_be32(data);
+		rem = (rem << 32) ^
+			enc_tab[3][w >> 24] ^ enc_tab[2][(w >> 16) & 0xff] ^
+			enc_tab[1][(w >> 8) & 0xff] ^ enc_tab[0][w & 0xff];
+		data += 4;
+		len -= 4;
 	}
-	if (err > 0) {
-		/* post-process raw error locations for easier correction */
-		nbits = (len*8)+BCH_ECC_BITS;
-		for (i = 0; i < err; i++) {
-			if (errloc[i] >= nbits) {
-				err = -1;
+	while (len--)
+		rem = (rem << 8) ^ enc_tab[0][(rem >> 56) ^ *data++];
+
+	return rem;
+}
+
+/**
+ * bch_encode - compute the ECC of a sector
+ * @data:     sector data
+ * @len:      data length in bytes
+ * @ecc:      output, BCH_ECC_BYTES bytes
+ *
+ * The parity bits follow the data in codeword order, most significant bit
+ * of the first byte first, and are left-aligned in @ecc (the low 4 bits of
+ * the last byte are zero).  This is the layout bch_decode() locations refer
+ * to, so errloc values >= 8*len index into @ecc.
+ */
+void bch_encode(const uint8_t *data, unsigned int len, uint8_t *ecc)
+{
+	uint64_t rem = encode_rem(data, len);
+	int i;
+
+	for (i = 0; i < BCH_ECC_BYTES; i++)
+		ecc[i] = rem >> (56-8*i);
+}
+
+/**
+ * bch_calculate_syndromes - compute syndromes of a received codeword
+ * @data:     sector data
+ * @len:      data length in bytes
+ * @ecc:      received ECC, BCH_ECC_BYTES bytes as written by bch_encode()
+ * @syn:      output, BCH_SYN_WORDS words laid out like the hardware ones
+ *
+ * Returns:
+ *  0 if the codeword is clean, non-zero if @syn should go to bch_decode()
+ *
+ * The codeword is first reduced modulo g(x) with the encoder tables; since
+ * the syndrome roots are roots of g(x), the odd syndromes are then
+ * evaluated on the 52-bit remainder only.
+ */
+int bch_calculate_syndromes(const uint8_t *data, unsigned int len,
+		const uint8_t *ecc, unsigned int *syn)
+{
+	const struct bch_control *bch = &bch_pollux;
+	uint64_t rem = encode_rem(data, len);
+	unsigned int i, j, d, s;
+	uint32_t hi, lo;
+
+	for (i = 0; i < BCH_ECC_BYTES; i++)
+		rem ^= (uint64_t)ecc[i] << (56-8*i);
+	rem >>= ENC_SHIFT;
+
+	memset(syn, 0, BCH_SYN_WORDS*sizeof(*syn));
+	if (!rem)
+		return 0;
+
+	hi = rem >> 32;
+	lo = rem;
+	for (j = 0; j < POLLUX_T; j++) {
+		s = 0;
+		for (d = 0; d < POLLUX_M*POLLUX_T; d++)
+			if (((d < 32) ? (lo >> d) : (hi >> (d-32))) & 1)
+				s ^= a_pow(bch, (2*j+1)*d);
+		syn[2*j] = s;
+	}
+	return 1;
+}
+
+/*
+ * build a base for factoring degree 2 polynomials: xi[i] solves
+ * x^2+x = a^i+Tr(a^i).a^k, where a^k is an element of trace 1
+ */
+static int build_deg2_base(struct bch_control *bch, unsigned int *xi)
+{
+	const unsigned int m = GF_M(bch);
+	unsigned int i, j, r, sum, x, y, remaining, ak = 0;
+	unsigned int found = 0;
+
+	/* find k s.t. Tr(a^k) = 1 and 0 <= k < m */
+	for (i = 0; i < m; i++) {
+		for (j = 0, sum = 0; j < m; j++)
+			sum ^= a_pow(bch, i*(1 << j));
+
+		if (sum) {
+			ak = A_POW_TAB(bch)[i];
+			break;
+		}
+	}
+
+	remaining = m;
+	for (x = 0; (x <= GF_N(bch)) && remaining; x++) {
+		y = gf_sqr(bch, x)^x;
+		for (i = 0; i < 2; i++) {
+			r = a_log(bch, y);
+			if (y && (r < m) && !(found & (1 << r))) {
+				xi[r] = x;
+				found |= 1 << r;
+				remaining--;
 				break;
 			}
-			errloc[i] = nbits-1-errloc[i];
-			errloc[i] = (errloc[i] & ~7)|(7-(errloc[i] & 7));
+			y ^= ak;
 		}
 	}
-	return (err >= 0) ? err : -1;
+	return remaining ? -1 : 0;
 }
 
 /**
- * bch_init - initialize a BCH decoder
+ * bch_init_ctrl - initialize a BCH decoder for an arbitrary code
+ * @bch:      decoder to set up
+ * @m:        Galois field order, 5 <= m <= BCH_MAX_M
+ * @t:        correction capability in bits, 1 <= t <= BCH_MAX_T
+ * @poly:     primitive polynomial of GF(2^m)
+ * @pow_tab:  storage for the antilog table, 2^m entries
+ * @log_tab:  storage for the log table, 2^m entries
+ *
+ * Returns:
+ *  0 on success, or -1 if the parameters are out of range or @poly is not
+ *  primitive
  */
-void bch_init(void)
+int bch_init_ctrl(struct bch_control *bch, unsigned int m, unsigned int t,
+		unsigned int poly, uint16_t *pow_tab, uint16_t *log_tab)
 {
 	unsigned int i, x = 1;
-	const unsigned int poly = 0x25AF;
+	const unsigned int n = (1 << m) - 1;
 	const unsigned int k = 1 << deg(poly);
 
-	for (i = 0; i < GF_N; i++) {
-		a_pow_tab[i] = x;
-		a_log_tab[x] = i;
+	if (m < 5 || m > BCH_MAX_M || t < 1 || t > BCH_MAX_T ||
+			deg(poly) != (int)m)
+		return -1;
+
+	memset(bch, 0, sizeof(*bch));
+	bch->m = m;
+	bch->n = n;
+	bch->t = t;
+	bch->ecc_bits = m * t;
+
+	for (i = 0; i < n; i++) {
+		pow_tab[i] = x;
+		log_tab[x] = i;
+		if (i && (x == 1))
+			return -1;
 		x <<= 1;
 		if (x & k)
 			x ^= poly;
 	}
-	a_pow_tab[GF_N] = 1;
-	a_log_tab[0] = 0;
+	pow_tab[n] = 1;
+	log_tab[0] = 0;
+
+	bch->a_pow_tab = pow_tab;
+	bch->a_log_tab = log_tab;
+	bch->xi_tab = bch->xi_buf;
+
+	return build_deg2_base(bch, bch->xi_buf);
+}
+
+#ifndef CONFIG_BCH_STATIC_TABLES
+/*
+ * generator polynomial of the Pollux code, the product of the minimal
+ * polynomials of a^1, a^3, ..., a^(2t-1), as a bitmask
+ */
+static uint64_t build_generator(const struct bch_control *bch)
+{
+	unsigned int g[POLLUX_M*POLLUX_T+1];
+	unsigned int d = 0, i, j, r, root;
+	uint64_t gen = 0;
+
+	memset(g, 0, sizeof(g));
+	g[0] = 1;
+
+	for (i = 1; i < 2*POLLUX_T; i += 2) {
+		for (r = 0; r < POLLUX_M; r++) {
+			/* multiply by (X+a^(i.2^r)) */
+			root = a_pow(bch, i << r);
+			g[d+1] = 0;
+			for (j = d+1; j > 0; j--)
+				g[j] = g[j-1]^gf_mul(bch, g[j], root);
+			g[0] = gf_mul(bch, g[0], root);
+			d++;
+		}
+	}
+	for (i = 0; i <= d; i++)
+		gen |= (uint64_t)g[i] << i;
+	return gen;
 }
 
+static void build_enc_tab(const struct bch_control *bch)
+{
+	const uint64_t gen = build_generator(bch) << ENC_SHIFT;
+	unsigned int b, i, k;
+	uint64_t rem;
+
+	for (b = 0; b < 256; b++) {
+		rem = (uint64_t)b << 56;
+		for (k = 0; k < 4; k++) {
+			for (i = 0; i < 8; i++)
+				rem = (rem & (1ULL << 63)) ? (rem << 1)^gen :
+					rem << 1;
+			enc_tab[k][b] = rem;
+		}
+	}
+}
+#endif
+
+/**
+ * bch_init - initialize the built-in 4-bit 0x25AF code
+ *
+ * With CONFIG_BCH_STATIC_TABLES the tables come pre-generated from
+ * tools/bch_tables.py and this is a no-op.
+ */
+void bch_init(void)
+{
+#ifndef CONFIG_BCH_STATIC_TABLES
+	bch_init_ctrl(&bch_pollux, POLLUX_M, POLLUX_T, POLLUX_POLY,
+			pollux_pow_tab, pollux_log_tab);
+	build_enc_tab(&bch_pollux);
+#endif
+}
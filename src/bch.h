@@ -1,5 +1,5 @@
 /*
- * 4-bit 0x25AF BCH syndrome decoder
+ * Binary BCH syndrome decoder, 4-bit 0x25AF by default
  *
  * This program is free software; you can redistribute it and/or modify it
  * under the terms of the GNU General Public License version 2 as published by
@@ -23,9 +23,61 @@
 #ifndef _BCH_H
 #define _BCH_H
 
+#include <stdint.h>
+
+/* the built-in 4-bit code used by bch_decode()/bch_decode_page() */
+#define BCH_MAX_ERRORS	4
+#define BCH_SYN_WORDS	(2 * BCH_MAX_ERRORS)
+#define BCH_ECC_BYTES	7
+
+/* limits for decoders set up with bch_init_ctrl() */
+#define BCH_MAX_M	15
+#define BCH_MAX_T	24
+
+/*
+ * represent a polynomial over GF(2^m)
+ */
+struct gf_poly {
+	unsigned int deg;                  /* polynomial degree */
+	unsigned int c[2*BCH_MAX_T+1];     /* polynomial terms */
+};
+
+/*
+ * decoder state, one per code; all scratch space lives here so separate
+ * decoders are independent of each other
+ */
+struct bch_control {
+	unsigned int            m;
+	unsigned int            n;
+	unsigned int            t;
+	unsigned int            ecc_bits;
+	const uint16_t          *a_pow_tab;
+	const uint16_t          *a_log_tab;
+	const unsigned int      *xi_tab;
+	unsigned int            xi_buf[BCH_MAX_M];
+	int                     cache[BCH_MAX_T+1];
+	struct gf_poly          elp;
+	struct gf_poly          pelp;
+	struct gf_poly          elp_copy;
+};
+
 void bch_init(void);
+int bch_init_ctrl(struct bch_control *bch, unsigned int m, unsigned int t,
+		unsigned int poly, uint16_t *pow_tab, uint16_t *log_tab);
 
 int bch_decode(unsigned int len, unsigned int *syn, unsigned int *errloc);
+int bch_decode_page(unsigned int len, unsigned int nsectors,
+		unsigned int *syn, unsigned int *errloc, int *nerr);
+
+void bch_encode(const uint8_t *data, unsigned int len, uint8_t *ecc);
+int bch_calculate_syndromes(const uint8_t *data, unsigned int len,
+		const uint8_t *ecc, unsigned int *syn);
+
+int bch_decode_ctrl(struct bch_control *bch, unsigned int len,
+		unsigned int *syn, unsigned int *errloc);
+int bch_decode_page_ctrl(struct bch_control *bch, unsigned int len,
+		unsigned int nsectors, unsigned int *syn,
+		unsigned int *errloc, int *nerr);
 
 #endif /* _BCH_H */
 
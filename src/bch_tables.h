@@ -0,0 +1,33 @@
+/*
+ * GF(2^13) tables for the 4-bit 0x25AF BCH decoder
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 as published by
+ * the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 51
+ * Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Based on:
+ *    Generic binary BCH encoding/decoding library
+ *    Copyright © 2011 Parrot S.A.
+ *    Author: Ivan Djelic <ivan.djelic@parrot.com>
+ */
+
+#ifndef _BCH_TABLES_H
+#define _BCH_TABLES_H
+
+#include <stdint.h>
+
+extern const uint16_t bch_a_pow_tab[8192];
+extern const uint16_t bch_a_log_tab[8192];
+extern const unsigned int bch_xi_tab[13];
+extern const uint64_t bch_enc_tab[4][256];
+
+#endif /* _BCH_TABLES_H */
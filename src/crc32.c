@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "asm/types.h"
+
+#include "crc32.h"
+
+#define CRC32_POLY_LE		0xEDB88320
+
+/*
+ * Slice-by-4: crc32_tab[k][b] is the CRC of byte b followed by k zero
+ * bytes.  Four tables (4 KiB) rather than eight keep the working set well
+ * inside the ARM926 data cache next to the packet being summed.
+ */
+u32 crc32_tab[4][256];
+
+void crc32_init(void)
+{
+	unsigned int i, j;
+	u32 crc;
+
+	for (i = 0; i < 256; i++) {
+		crc = i;
+		for (j = 0; j < 8; j++)
+			crc = (crc >> 1) ^ ((crc & 1) ? CRC32_POLY_LE : 0);
+		crc32_tab[0][i] = crc;
+	}
+	for (i = 0; i < 256; i++)
+		for (j = 1; j < 4; j++)
+			crc32_tab[j][i] = (crc32_tab[j - 1][i] >> 8) ^
+					crc32_tab[0][crc32_tab[j - 1][i] & 0xFF];
+}
+
+/**
+ * crc32 - update a CRC-32 (IEEE 802.3, as zlib's crc32())
+ * @crc:      CRC of the preceding data, 0 to start
+ * @buf:      data
+ * @len:      length in bytes
+ *
+ * crc32(crc32(0, a, n), b, m) equals the CRC of a followed by b, so a
+ * stream can be summed packet by packet as it arrives.
+ */
+u32 crc32(u32 crc, const void *buf, unsigned int len)
+{
+	const u8 *p = buf;
+
+	crc = ~crc;
+
+	while (len && ((unsigned long) p & 3)) {
+		crc = (crc >> 8) ^ crc32_tab[0][(crc ^ *p++) & 0xFF];
+		len--;
+	}
+
+	/* little endian word loads once aligned */
+	for (; len >= 4; len -= 4, p += 4)
+		crc = crc32_word(crc, *(const u32 *) p);
+
+	while (len--)
+		crc = (crc >> 8) ^ crc32_tab[0][(crc ^ *p++) & 0xFF];
+
+	return ~crc;
+}
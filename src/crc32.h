@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _CRC32_H
+#define _CRC32_H
+
+#include "asm/types.h"
+
+extern u32 crc32_tab[4][256];
+
+void crc32_init(void);
+u32 crc32(u32 crc, const void *buf, unsigned int len);
+
+/*
+ * Fold one little endian word into a running CRC.  @crc is kept inverted,
+ * as crc32() does internally: start from ~crc and invert the result.
+ */
+static inline u32 crc32_word(u32 crc, u32 w)
+{
+	w ^= crc;
+	return crc32_tab[3][w & 0xFF] ^ crc32_tab[2][(w >> 8) & 0xFF] ^
+			crc32_tab[1][(w >> 16) & 0xFF] ^ crc32_tab[0][w >> 24];
+}
+
+#endif /* _CRC32_H */
@@ -53,7 +53,7 @@ struct usb_device_config_descriptor hs_config_descriptor = {
 		.bDescriptorType     = USB_DT_CONFIG,
 		.wTotalLength        = USB_DT_CONFIG_SIZE +
 		                       USB_DT_INTERFACE_SIZE +
-		                       (USB_DT_ENDPOINT_SIZE * 1),
+		                       (USB_DT_ENDPOINT_SIZE * 2),
 		.bNumInterfaces      = 1,
 		.bConfigurationValue = 1,
 		.bmAttributes        = USB_CONFIG_ATT_ONE |
@@ -63,7 +63,7 @@ struct usb_device_config_descriptor hs_config_descriptor = {
 		.bLength             = USB_DT_INTERFACE_SIZE,
 		.bDescriptorType     = USB_DT_INTERFACE,
 		.bInterfaceNumber    = 0,
-		.bNumEndpoints       = 1,
+		.bNumEndpoints       = 2,
 	},
 	.ep1 = {
 		.bLength             = USB_DT_ENDPOINT_SIZE,
@@ -72,6 +72,13 @@ struct usb_device_config_descriptor hs_config_descriptor = {
 		.bmAttributes        = USB_ENDPOINT_XFER_BULK,
 		.wMaxPacketSize      = 512,
 	},
+	.ep2 = {
+		.bLength             = USB_DT_ENDPOINT_SIZE,
+		.bDescriptorType     = USB_DT_ENDPOINT,
+		.bEndpointAddress    = 2 | USB_DIR_IN,
+		.bmAttributes        = USB_ENDPOINT_XFER_BULK,
+		.wMaxPacketSize      = 512,
+	},
 };
 
 /* Full speed descriptors */
@@ -103,7 +110,7 @@ struct usb_device_config_descriptor fs_config_descriptor = {
 		.bLength             = USB_DT_CONFIG_SIZE,
 		.bDescriptorType     = USB_DT_CONFIG,
 		.wTotalLength        = USB_DT_CONFIG_SIZE + USB_DT_INTERFACE_SIZE +
-		                       (USB_DT_ENDPOINT_SIZE * 1),
+		                       (USB_DT_ENDPOINT_SIZE * 2),
 		.bNumInterfaces      = 1,
 		.bConfigurationValue = 1,
 		.bmAttributes        = USB_CONFIG_ATT_ONE |
@@ -113,7 +120,7 @@ struct usb_device_config_descriptor fs_config_descriptor = {
 		.bLength             = USB_DT_INTERFACE_SIZE,
 		.bDescriptorType     = USB_DT_INTERFACE,
 		.bInterfaceNumber    = 0,
-		.bNumEndpoints       = 1,
+		.bNumEndpoints       = 2,
 	},
 	.ep1 = {
 		.bLength             = USB_DT_ENDPOINT_SIZE,
@@ -122,6 +129,13 @@ struct usb_device_config_descriptor fs_config_descriptor = {
 		.bmAttributes        = USB_ENDPOINT_XFER_BULK,
 		.wMaxPacketSize      = 64,
 	},
+	.ep2 = {
+		.bLength             = USB_DT_ENDPOINT_SIZE,
+		.bDescriptorType     = USB_DT_ENDPOINT,
+		.bEndpointAddress    = 2 | USB_DIR_IN,
+		.bmAttributes        = USB_ENDPOINT_XFER_BULK,
+		.wMaxPacketSize      = 64,
+	},
 };
 
 /* String descriptors */
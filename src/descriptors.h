@@ -27,16 +27,17 @@ struct usb_device_config_descriptor {
 	struct usb_config_descriptor cfg;
 	struct usb_interface_descriptor if0;
 	struct usb_endpoint_descriptor ep1;
+	struct usb_endpoint_descriptor ep2;
 } __attribute__((packed));
 
-const struct usb_device_descriptor hs_device_descriptor;
-const struct usb_qualifier_descriptor hs_qualifier_descriptor;
-struct usb_device_config_descriptor hs_config_descriptor;
+extern const struct usb_device_descriptor hs_device_descriptor;
+extern const struct usb_qualifier_descriptor hs_qualifier_descriptor;
+extern struct usb_device_config_descriptor hs_config_descriptor;
 
-const struct usb_device_descriptor fs_device_descriptor;
-const struct usb_qualifier_descriptor fs_qualifier_descriptor;
-struct usb_device_config_descriptor fs_config_descriptor;
+extern const struct usb_device_descriptor fs_device_descriptor;
+extern const struct usb_qualifier_descriptor fs_qualifier_descriptor;
+extern struct usb_device_config_descriptor fs_config_descriptor;
 
-const struct usb_string_descriptor *string_descriptor[NUM_STRING_DESC];
+extern const struct usb_string_descriptor *string_descriptor[NUM_STRING_DESC];
 
 #endif /* _DESCRIPTORS_H */
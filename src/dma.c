@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdbool.h>
+
+#include "asm/io.h"
+#include "asm/types.h"
+
+#include "dma.h"
+
+#define DMA_BASE		0xC0000000
+#define DMA_CHANNEL(ch)		((void __iomem *)(DMA_BASE + ((ch) * 0x80)))
+
+#define DMA_SRCADDR		0x00
+#define DMA_DSTADDR		0x04
+#define DMA_LENGTH		0x08
+#define DMA_REQID		0x0A
+#define DMA_MODE		0x0C
+
+#define DMA_MODE_SRCIOSIZE_16	(1 << 0)
+#define DMA_MODE_SRCIOMODE	(1 << 5)
+#define DMA_MODE_SRCNOTINC	(1 << 6)
+#define DMA_MODE_DSTIOSIZE_32	(2 << 8)
+#define DMA_MODE_BUSY		(1 << 16)
+#define DMA_MODE_INTPEND	(1 << 17)
+#define DMA_MODE_RUN		(1 << 19)
+#define DMA_MODE_STOP		(1 << 20)
+
+#define CACHE_LINE_SIZE		32
+
+/**
+ * dma_io_to_mem - start a peripheral to memory transfer
+ * @ch:       channel number
+ * @io:       physical address of the 16-bit peripheral data register
+ * @req_id:   peripheral request line
+ * @dst:      word aligned destination buffer
+ * @length:   number of bytes, at most DMA_MAX_LENGTH
+ *
+ * The destination must already be clean in the data cache, see
+ * dma_inv_range().  Completion is polled with dma_busy().
+ */
+void dma_io_to_mem(unsigned int ch, u32 io, u8 req_id, void *dst,
+		u32 length)
+{
+	void __iomem *regs = DMA_CHANNEL(ch);
+
+	writel(io, regs + DMA_SRCADDR);
+	writel((u32)(unsigned long) dst, regs + DMA_DSTADDR);
+	writew(length - 1, regs + DMA_LENGTH);
+	writew(req_id, regs + DMA_REQID);
+	writel(DMA_MODE_SRCIOSIZE_16 | DMA_MODE_SRCIOMODE |
+			DMA_MODE_SRCNOTINC | DMA_MODE_DSTIOSIZE_32 |
+			DMA_MODE_INTPEND | DMA_MODE_RUN, regs + DMA_MODE);
+}
+
+bool dma_busy(unsigned int ch)
+{
+	return readl(DMA_CHANNEL(ch) + DMA_MODE) & DMA_MODE_BUSY;
+}
+
+void dma_stop(unsigned int ch)
+{
+	void __iomem *regs = DMA_CHANNEL(ch);
+
+	writel(DMA_MODE_STOP | DMA_MODE_INTPEND, regs + DMA_MODE);
+	while (readl(regs + DMA_MODE) & DMA_MODE_BUSY);
+}
+
+/*
+ * clean and invalidate the data cache lines covering a buffer, so neither
+ * stale nor dirty lines can shadow what the DMA engine writes
+ */
+__attribute__((target("arm")))
+void dma_inv_range(void *start, u32 length)
+{
+	unsigned long addr = (unsigned long) start & ~(CACHE_LINE_SIZE - 1);
+	unsigned long end = (unsigned long) start + length;
+
+	for (; addr < end; addr += CACHE_LINE_SIZE)
+		asm volatile("mcr p15, 0, %0, c7, c14, 1" : : "r" (addr));
+
+	/* drain write buffer */
+	asm volatile("mcr p15, 0, %0, c7, c10, 4" : : "r" (0) : "memory");
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _DMA_H
+#define _DMA_H
+
+#include <stdbool.h>
+
+#include "asm/types.h"
+
+#define DMA_CHANNEL_UDC		0
+
+#define DMA_REQ_UDC		13
+
+#define DMA_MAX_LENGTH		0x10000
+
+void dma_io_to_mem(unsigned int ch, u32 io, u8 req_id, void *dst,
+		u32 length);
+bool dma_busy(unsigned int ch);
+void dma_stop(unsigned int ch);
+void dma_inv_range(void *start, u32 length);
+
+#endif /* _DMA_H */
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "asm/io.h"
+#include "asm/types.h"
+
+#include "irq.h"
+
+/* Pollux interrupt controller */
+#define INTC_BASE		0xC0000800
+
+#define INTC_MODEL		0x08
+#define INTC_MODEH		0x0C
+#define INTC_MASKL		0x10
+#define INTC_MASKH		0x14
+#define INTC_PENDL		0x20
+#define INTC_PENDH		0x24
+
+#define NUM_IRQS		32	/* sources in the low bank */
+
+#define PSR_I_BIT		0x80
+#define PSR_F_BIT		0x40
+#define PSR_MODE_IRQ		0x12
+
+#define CR_V			(1 << 13)	/* high vectors */
+
+/* ldr pc, [pc, #0x18]: jump through the word 0x20 past the vector */
+#define LDR_PC_PC_18		0xE59FF018
+#define VECTOR_IRQ		(0x18 / 4)
+
+/*
+ * IRQ mode code must be ARM, not Thumb: the exception entry and the
+ * status register accesses below have no Thumb-1 encoding.
+ */
+#define __arm			__attribute__((target("arm")))
+
+static void __iomem *intc = (void __iomem *) INTC_BASE;
+static void (*handlers[NUM_IRQS])(void);
+static u32 irq_stack[512] __attribute__((aligned(8)));
+
+/*
+ * Runs with IRQs masked at the CPU, so handlers never nest.  Pending bits
+ * are cleared after the handlers have cleared their sources, which are
+ * level triggered.
+ */
+static void __arm __attribute__((interrupt("IRQ"))) irq_handler(void)
+{
+	u32 pend = readl(intc + INTC_PENDL) & ~readl(intc + INTC_MASKL);
+	u32 bits = pend;
+	unsigned int irq;
+
+	for (irq = 0; bits; irq++, bits >>= 1)
+		if ((bits & 1) && handlers[irq])
+			handlers[irq]();
+
+	writel(pend, intc + INTC_PENDL);
+}
+
+static void __arm irq_set_stack(void)
+{
+	u32 cpsr;
+
+	asm volatile(
+		"mrs	%0, cpsr\n"
+		"msr	cpsr_c, %1\n"
+		"mov	sp, %2\n"
+		"msr	cpsr_c, %0\n"
+		: "=&r" (cpsr)
+		: "r" (PSR_MODE_IRQ | PSR_I_BIT | PSR_F_BIT),
+		  "r" (irq_stack + sizeof(irq_stack) / sizeof(irq_stack[0]))
+		: "memory");
+}
+
+static void __arm irq_set_vector(void)
+{
+	u32 *vectors, cr;
+
+	asm volatile("mrc	p15, 0, %0, c1, c0, 0" : "=r" (cr));
+	vectors = (u32 *) ((cr & CR_V) ? 0xFFFF0000 : 0);
+
+	vectors[VECTOR_IRQ] = LDR_PC_PC_18;
+	vectors[VECTOR_IRQ + 8] = (u32) irq_handler;
+
+	/*
+	 * Clean both words out of a write-back D-cache, drain the write
+	 * buffer and drop stale vectors from the I-cache.
+	 */
+	asm volatile(
+		"mcr	p15, 0, %0, c7, c10, 1\n"
+		"mcr	p15, 0, %1, c7, c10, 1\n"
+		"mcr	p15, 0, %2, c7, c10, 4\n"
+		"mcr	p15, 0, %2, c7, c5, 0\n"
+		: : "r" (&vectors[VECTOR_IRQ]), "r" (&vectors[VECTOR_IRQ + 8]),
+		    "r" (0)
+		: "memory");
+}
+
+/**
+ * irq_init - take over the IRQ exception with every source masked
+ *
+ * The vector table must be in RAM; the loader is linked to run there.
+ * Sources are unmasked by irq_request(), and the CPU takes interrupts
+ * once irq_restore() is handed flags with the I bit clear, or right
+ * away here.
+ */
+void irq_init(void)
+{
+	writel(~0, intc + INTC_MASKL);
+	writel(~0, intc + INTC_MASKH);
+	writel(0, intc + INTC_MODEL);
+	writel(0, intc + INTC_MODEH);
+	writel(~0, intc + INTC_PENDL);
+	writel(~0, intc + INTC_PENDH);
+
+	irq_set_stack();
+	irq_set_vector();
+	irq_restore(irq_save() & ~PSR_I_BIT);
+}
+
+/* mask everything again, before handing the CPU to a loaded image */
+void irq_exit(void)
+{
+	irq_save();
+	writel(~0, intc + INTC_MASKL);
+	writel(~0, intc + INTC_MASKH);
+}
+
+void irq_request(unsigned int irq, void (*handler)(void))
+{
+	u32 flags = irq_save();
+
+	handlers[irq] = handler;
+	writel(readl(intc + INTC_MASKL) & ~(1 << irq), intc + INTC_MASKL);
+	irq_restore(flags);
+}
+
+/* mask IRQs at the CPU, returning the previous state for irq_restore() */
+u32 __arm irq_save(void)
+{
+	u32 flags, tmp;
+
+	asm volatile(
+		"mrs	%0, cpsr\n"
+		"orr	%1, %0, %2\n"
+		"msr	cpsr_c, %1\n"
+		: "=&r" (flags), "=&r" (tmp)
+		: "i" (PSR_I_BIT)
+		: "memory");
+	return flags;
+}
+
+void __arm irq_restore(u32 flags)
+{
+	asm volatile("msr	cpsr_c, %0" : : "r" (flags) : "memory");
+}
+
+/*
+ * Sleep until an interrupt is pending.  The ARM926 wakes on a pending
+ * IRQ even with the I bit set, so callers check for work and sleep with
+ * IRQs masked and nothing is lost in between.
+ */
+void __arm irq_wfi(void)
+{
+	asm volatile("mcr	p15, 0, %0, c7, c0, 4" : : "r" (0) : "memory");
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _IRQ_H
+#define _IRQ_H
+
+#include "asm/types.h"
+
+/* interrupt controller sources */
+#define IRQ_TIMER0		1
+#define IRQ_UDC			20
+
+#ifdef CONFIG_INTERRUPTS
+void irq_init(void);
+void irq_exit(void);
+void irq_request(unsigned int irq, void (*handler)(void));
+u32 irq_save(void);
+void irq_restore(u32 flags);
+void irq_wfi(void);
+#else
+static inline u32 irq_save(void)
+{
+	return 0;
+}
+
+static inline void irq_restore(u32 flags)
+{
+}
+#endif
+
+#endif /* _IRQ_H */
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <string.h>
+
+#include "asm/types.h"
+
+#include "lz4.h"
+
+#define LZ4_MIN_MATCH		4
+
+/* length nibble plus any 255-continued extension bytes */
+static int lz4_length(unsigned int len, const u8 **ip, const u8 *ip_end)
+{
+	u8 b;
+
+	if (len != 15)
+		return len;
+
+	do {
+		if (*ip >= ip_end)
+			return -1;
+		b = *(*ip)++;
+		len += b;
+	} while (b == 255);
+	return len;
+}
+
+/**
+ * lz4_decompress - decode one LZ4 block
+ * @src:      compressed block, without the frame's block size word
+ * @src_len:  length of the block
+ * @dst:      output position for this block
+ * @dst_base: start of the whole output, matches may reach back to it
+ * @dst_end:  end of the room for output
+ *
+ * Blocks of one image are decoded back to back into the same output, so
+ * a block may copy from anything decoded before it (linked blocks).
+ *
+ * Returns:
+ *  number of bytes written, or -1 if the block is malformed or would
+ *  write outside [dst_base, dst_end)
+ */
+int lz4_decompress(const u8 *src, unsigned int src_len, u8 *dst,
+		const u8 *dst_base, const u8 *dst_end)
+{
+	const u8 *ip = src, *ip_end = src + src_len;
+	const u8 *match;
+	u8 *op = dst;
+	unsigned int token, offset;
+	int len;
+
+	while (ip < ip_end) {
+		token = *ip++;
+
+		len = lz4_length(token >> 4, &ip, ip_end);
+		if (len < 0 || len > ip_end - ip || len > dst_end - op)
+			return -1;
+		memcpy(op, ip, len);
+		op += len;
+		ip += len;
+
+		/* the last sequence carries literals only */
+		if (ip == ip_end)
+			break;
+
+		if (ip_end - ip < 2)
+			return -1;
+		offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+		if (!offset || offset > (unsigned int) (op - dst_base))
+			return -1;
+
+		len = lz4_length(token & 15, &ip, ip_end);
+		if (len < 0)
+			return -1;
+		len += LZ4_MIN_MATCH;
+		if (len > dst_end - op)
+			return -1;
+
+		match = op - offset;
+		if (offset >= (unsigned int) len) {
+			memcpy(op, match, len);
+			op += len;
+		} else {
+			/* overlapping copy repeats the last offset bytes */
+			while (len--)
+				*op++ = *match++;
+		}
+	}
+
+	return op - dst;
+}
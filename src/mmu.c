@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "asm/types.h"
+
+#include "mmu.h"
+
+/*
+ * The loader runs with a flat (identity) map of 1 MiB sections, so DMA
+ * and the host see the same addresses as the CPU.  The low 2 GiB, where
+ * SDRAM is, are write-back cached; the static bus (NAND), the peripheral
+ * registers and the high vectors above it are strongly ordered.
+ */
+#define SECTION_SHIFT		20
+#define NUM_SECTIONS		4096
+#define CACHED_SECTIONS		(0x80000000 >> SECTION_SHIFT)
+
+#define PMD_TYPE_SECT		(2 << 0)
+#define PMD_SECT_BUFFERABLE	(1 << 2)
+#define PMD_SECT_CACHEABLE	(1 << 3)
+#define PMD_BIT4		(1 << 4)	/* should be one on ARMv5 */
+#define PMD_SECT_AP_RW		(3 << 10)
+
+#define PMD_SECT_DEVICE		(PMD_TYPE_SECT | PMD_BIT4 | PMD_SECT_AP_RW)
+#define PMD_SECT_WB		(PMD_SECT_DEVICE | PMD_SECT_CACHEABLE | \
+				 PMD_SECT_BUFFERABLE)
+
+#define DOMAIN_CLIENT		1
+
+#define CR_M			(1 << 0)	/* MMU */
+#define CR_C			(1 << 2)	/* D-cache */
+#define CR_I			(1 << 12)	/* I-cache */
+
+#define __arm			__attribute__((target("arm")))
+
+static u32 mmu_table[NUM_SECTIONS] __attribute__((aligned(16384)));
+
+/* the boot code's control register, table base and domains */
+static u32 saved_cr, saved_ttb, saved_dacr;
+
+/* write back and invalidate the whole D-cache, then drain the write buffer */
+static void __arm dcache_flush_all(void)
+{
+	asm volatile(
+		"1:	mrc	p15, 0, APSR_nzcv, c7, c14, 3\n"
+		"	bne	1b\n"
+		"	mcr	p15, 0, %0, c7, c10, 4\n"
+		: : "r" (0) : "cc", "memory");
+}
+
+static inline u32 __arm cr_read(void)
+{
+	u32 cr;
+
+	asm volatile("mrc	p15, 0, %0, c1, c0, 0" : "=r" (cr));
+	return cr;
+}
+
+static inline void __arm cr_write(u32 cr)
+{
+	asm volatile("mcr	p15, 0, %0, c1, c0, 0" : : "r" (cr) : "memory");
+}
+
+/**
+ * mmu_init - turn on the MMU and both caches for the loader
+ *
+ * Whatever the boot code left in the D-cache is written back first, so
+ * turning the map on cannot lose or resurrect data.
+ */
+void __arm mmu_init(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < NUM_SECTIONS; i++)
+		mmu_table[i] = (i << SECTION_SHIFT) | ((i < CACHED_SECTIONS) ?
+				PMD_SECT_WB : PMD_SECT_DEVICE);
+
+	saved_cr = cr_read();
+	asm volatile(
+		"mrc	p15, 0, %0, c2, c0, 0\n"
+		"mrc	p15, 0, %1, c3, c0, 0\n"
+		: "=r" (saved_ttb), "=r" (saved_dacr));
+
+	dcache_flush_all();
+	asm volatile(
+		"mcr	p15, 0, %0, c7, c5, 0\n"	/* invalidate I-cache */
+		"mcr	p15, 0, %0, c8, c7, 0\n"	/* invalidate TLBs */
+		"mcr	p15, 0, %1, c2, c0, 0\n"	/* table base */
+		"mcr	p15, 0, %2, c3, c0, 0\n"	/* domain 0 client */
+		: : "r" (0), "r" (mmu_table), "r" (DOMAIN_CLIENT)
+		: "memory");
+
+	cr_write(saved_cr | CR_M | CR_C | CR_I);
+}
+
+/**
+ * mmu_exit - write everything back and restore the MMU and caches
+ *
+ * Called before a loaded image is started, and before a normal boot, so
+ * that what the loader wrote through the D-cache is in SDRAM and no
+ * stale instructions are left in the I-cache.  M, C and I, the table
+ * base and the domains go back to what the boot code had set up before
+ * mmu_init(), instead of leaving the caches off.
+ */
+void __arm mmu_exit(void)
+{
+	dcache_flush_all();
+	cr_write(cr_read() & ~(CR_M | CR_C | CR_I));
+	asm volatile(
+		"mcr	p15, 0, %0, c7, c5, 0\n"	/* invalidate I-cache */
+		"mcr	p15, 0, %0, c8, c7, 0\n"	/* invalidate TLBs */
+		"mcr	p15, 0, %1, c2, c0, 0\n"
+		"mcr	p15, 0, %2, c3, c0, 0\n"
+		: : "r" (0), "r" (saved_ttb), "r" (saved_dacr) : "memory");
+	cr_write(cr_read() | (saved_cr & (CR_M | CR_C | CR_I)));
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "asm/types.h"
+#include "mach/udc.h"
+
+#include "bch.h"
+#include "crc32.h"
+#include "mmu.h"
+#include "timer.h"
+#include "udc_fifo.h"
+
+/*
+ * Boot-time timing of the loader's hot loops, printed on the console
+ * once before mmu_init() and once after it, so the effect of the caches
+ * can be read off a board without a debugger.  Each loop is run ROUNDS
+ * times back to back and the total is divided out, which keeps the
+ * TIMER1 resolution out of the result.
+ */
+#define ROUNDS			64
+#define SECTOR			512
+#define CRC_LEN			16384
+
+static u8 bench_buf[CRC_LEN] __attribute__((aligned(4)));
+
+static u32 per_round_ns(u32 start)
+{
+	return timer_ticks_to_ns(timer_ticks() - start) / ROUNDS;
+}
+
+/* a sector with four bit errors, the worst the built-in code corrects */
+static void bch_setup(unsigned int *syn)
+{
+	u8 ecc[BCH_ECC_BYTES];
+	unsigned int i;
+
+	for (i = 0; i < SECTOR; i++)
+		bench_buf[i] = i * 7;
+	bch_encode(bench_buf, SECTOR, ecc);
+
+	bench_buf[3] ^= 0x01;
+	bench_buf[100] ^= 0x20;
+	bench_buf[301] ^= 0x80;
+	ecc[2] ^= 0x04;
+	bch_calculate_syndromes(bench_buf, SECTOR, ecc, syn);
+}
+
+/**
+ * mmu_bench - time BCH decode, crc32 and the FIFO drain
+ * @label:    cache state, printed with the results
+ *
+ * Runs before udc_init(), so the FIFO reads drain an endpoint buffer
+ * nobody uses yet and the data is thrown away.
+ */
+void mmu_bench(const char *label)
+{
+	void __iomem *fifo = (void __iomem *) UDC_BASE + UDC_BR(1);
+	unsigned int syn[BCH_SYN_WORDS], errloc[BCH_MAX_ERRORS];
+	u32 start, bch_ns, crc_ns, fifo_ns;
+	unsigned int i;
+	int err = 0;
+
+	bch_init();
+	crc32_init();
+
+	bch_setup(syn);
+	start = timer_ticks();
+	for (i = 0; i < ROUNDS; i++)
+		err |= bch_decode(SECTOR, syn, errloc) != BCH_MAX_ERRORS;
+	bch_ns = per_round_ns(start);
+
+	start = timer_ticks();
+	for (i = 0; i < ROUNDS; i++)
+		crc32(0, bench_buf, CRC_LEN);
+	crc_ns = per_round_ns(start);
+
+	start = timer_ticks();
+	for (i = 0; i < ROUNDS; i++)
+		udc_fifo_read(fifo, bench_buf, SECTOR);
+	fifo_ns = per_round_ns(start);
+
+	printf("caches %s: bch_decode(4 errors) %lu ns, crc32(16 KiB) %lu ns,"
+			" udc_fifo_read(512) %lu ns%s\n", label,
+			(unsigned long) bch_ns, (unsigned long) crc_ns,
+			(unsigned long) fifo_ns, err ? ", decode FAILED" : "");
+}
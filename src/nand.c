@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdbool.h>
+
+#include "asm/io.h"
+#include "asm/types.h"
+
+#include "bch.h"
+#include "nand.h"
+
+/* NAND window on the static bus */
+#define NAND_BASE		0xAC000000
+
+#define NAND_DATA		0x00
+#define NAND_CMD		0x10
+#define NAND_ADDR		0x18
+
+#define NAND_CMD_READ0		0x00
+#define NAND_CMD_READSTART	0x30
+#define NAND_CMD_SEQIN		0x80
+#define NAND_CMD_PAGEPROG	0x10
+#define NAND_CMD_ERASE1		0x60
+#define NAND_CMD_ERASE2		0xD0
+#define NAND_CMD_STATUS		0x70
+#define NAND_CMD_READID		0x90
+#define NAND_CMD_RESET		0xFF
+
+#define NAND_STATUS_FAIL	(1 << 0)
+#define NAND_STATUS_READY	(1 << 6)
+
+static void __iomem *nfc = (void __iomem *) NAND_BASE;
+static u8 status;
+
+struct nand_info nand;
+
+static inline void nand_cmd(u8 cmd)
+{
+	writeb(cmd, nfc + NAND_CMD);
+}
+
+static inline void nand_addr(u8 addr)
+{
+	writeb(addr, nfc + NAND_ADDR);
+}
+
+static void nand_row(u32 page)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_NAND_ROW_CYCLES; i++, page >>= 8)
+		nand_addr(page & 0xFF);
+}
+
+static void nand_read_buf(u8 *buf, unsigned int len)
+{
+	while (len--)
+		*buf++ = readb(nfc + NAND_DATA);
+}
+
+static void nand_write_buf(const u8 *buf, unsigned int len)
+{
+	while (len--)
+		writeb(*buf++, nfc + NAND_DATA);
+}
+
+/**
+ * nand_init - reset the chip and read its geometry
+ *
+ * Only large page chips are handled; page, spare and block sizes are
+ * decoded from the fourth ID byte.
+ *
+ * Returns:
+ *  0 on success, -1 if no usable chip was found
+ */
+int nand_init(void)
+{
+	unsigned int i, sectors;
+
+	nand_cmd(NAND_CMD_RESET);
+	while (nand_busy());
+
+	nand_cmd(NAND_CMD_READID);
+	nand_addr(0);
+	for (i = 0; i < sizeof(nand.id); i++)
+		nand.id[i] = readb(nfc + NAND_DATA);
+
+	if (nand.id[0] == 0x00 || nand.id[0] == 0xFF)
+		return -1;
+
+	nand.page_size = 1024 << (nand.id[3] & 3);
+	nand.oob_size = (nand.page_size / NAND_SECTOR_SIZE) *
+			(8 << ((nand.id[3] >> 2) & 1));
+	nand.pages_per_block = ((64 * 1024) << ((nand.id[3] >> 4) & 3)) /
+			nand.page_size;
+
+	sectors = nand.page_size / NAND_SECTOR_SIZE;
+	if (nand.page_size > NAND_MAX_PAGE_SIZE ||
+			NAND_ECC_OFFSET(nand.oob_size, sectors) < 2)
+		return -1;
+
+	bch_init();
+	return 0;
+}
+
+/**
+ * nand_erase_start - start erasing a block
+ * @page:     any page in the block
+ *
+ * Completion is polled with nand_busy(), then checked with nand_result().
+ */
+void nand_erase_start(u32 page)
+{
+	nand_cmd(NAND_CMD_ERASE1);
+	nand_row(page);
+	nand_cmd(NAND_CMD_ERASE2);
+}
+
+/**
+ * nand_program_start - transfer a page to the chip and start programming
+ * @page:     page number
+ * @data:     nand.page_size bytes
+ * @oob:      nand.oob_size bytes of spare area
+ *
+ * Returns as soon as the chip has the data, so the caller can prepare the
+ * next page while the array is being programmed.  Completion is polled
+ * with nand_busy(), then checked with nand_result().
+ */
+void nand_program_start(u32 page, const u8 *data, const u8 *oob)
+{
+	nand_cmd(NAND_CMD_SEQIN);
+	nand_addr(0);
+	nand_addr(0);
+	nand_row(page);
+	nand_write_buf(data, nand.page_size);
+	nand_write_buf(oob, nand.oob_size);
+	nand_cmd(NAND_CMD_PAGEPROG);
+}
+
+/**
+ * nand_read_start - start loading a page into the chip's page register
+ * @page:     page number
+ *
+ * Poll nand_busy() before fetching the page with nand_read_page().
+ */
+void nand_read_start(u32 page)
+{
+	nand_cmd(NAND_CMD_READ0);
+	nand_addr(0);
+	nand_addr(0);
+	nand_row(page);
+	nand_cmd(NAND_CMD_READSTART);
+}
+
+/**
+ * nand_block_bad - check the factory bad block marker
+ * @page:     any page in the block
+ *
+ * The marker is the first spare byte of the block's first page; anything
+ * but 0xFF there marks the block bad.  Waits for the chip, so only call
+ * it while no erase or program is in flight.
+ */
+bool nand_block_bad(u32 page)
+{
+	nand_cmd(NAND_CMD_READ0);
+	nand_addr(nand.page_size & 0xFF);
+	nand_addr(nand.page_size >> 8);
+	nand_row(page - page % nand.pages_per_block);
+	nand_cmd(NAND_CMD_READSTART);
+	while (nand_busy());
+
+	nand_cmd(NAND_CMD_READ0);
+	return readb(nfc + NAND_DATA) != 0xFF;
+}
+
+/* fetch the page loaded by nand_read_start(), data then spare area */
+void nand_read_page(u8 *data, u8 *oob)
+{
+	/* status polling left the chip in status output mode */
+	nand_cmd(NAND_CMD_READ0);
+	nand_read_buf(data, nand.page_size);
+	nand_read_buf(oob, nand.oob_size);
+}
+
+bool nand_busy(void)
+{
+	nand_cmd(NAND_CMD_STATUS);
+	status = readb(nfc + NAND_DATA);
+	return !(status & NAND_STATUS_READY);
+}
+
+/* result of the last erase or program, once nand_busy() returned false */
+int nand_result(void)
+{
+	return (status & NAND_STATUS_FAIL) ? -1 : 0;
+}
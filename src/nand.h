@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _NAND_H
+#define _NAND_H
+
+#include <stdbool.h>
+
+#include "asm/types.h"
+
+#define NAND_SECTOR_SIZE	512
+#define NAND_MAX_PAGE_SIZE	4096
+#define NAND_MAX_OOB_SIZE	128
+
+/*
+ * Each 512-byte sector is protected by BCH_ECC_BYTES of bch_encode()
+ * parity.  The parity of all sectors is packed at the end of the spare
+ * area, leaving the bad block marker at its start alone.
+ */
+#define NAND_ECC_OFFSET(oob_size, sectors) \
+	((oob_size) - (sectors) * BCH_ECC_BYTES)
+
+struct nand_info {
+	u32			page_size;
+	u32			oob_size;
+	u32			pages_per_block;
+	u8			id[4];
+};
+
+extern struct nand_info nand;
+
+int nand_init(void);
+void nand_erase_start(u32 page);
+void nand_program_start(u32 page, const u8 *data, const u8 *oob);
+void nand_read_start(u32 page);
+void nand_read_page(u8 *data, u8 *oob);
+bool nand_block_bad(u32 page);
+bool nand_busy(void);
+int nand_result(void);
+
+#endif /* _NAND_H */
@@ -20,13 +20,31 @@
 #include "asm/io.h"
 #include "mach/udc.h"
 
+#include "irq.h"
+#include "mmu.h"
+#include "sched.h"
 #include "timer.h"
 #include "udc.h"
 #include "udc_driver.h"
 
 
 bool timeout_aborted = 0;
+static bool timed_out;
 
+static void timeout_task(void);
+
+static DEFINE_TASK(timeout_work, timeout_task);
+#ifndef CONFIG_INTERRUPTS
+static DEFINE_TASK(udc_work, udc_task);
+static DEFINE_TASK(timer_work, timer_task);
+#endif
+
+/* a command from the host cancels the timeout */
+static void timeout_task(void)
+{
+	task_stop(&timeout_work);
+	timed_out = !timeout_aborted;
+}
 
 static void try_usb(void)
 {
@@ -43,11 +61,41 @@ static void try_usb(void)
 	if (readw(udc + UDC_TR) & UDC_TR_VBUS) {
 		puts("Detected VBUS power, waiting...");
 		timer_init();
-		udc_init(&udc_driver);
-		while (timeout_aborted || msecs < 2000) {
-			udc_task();
-			timer_task();
+		mmu_bench("off");
+		mmu_init();
+		mmu_bench("on");
+		if (udc_init(&udc_driver)) {
+			/* the driver's buffers do not fit the arena */
+			puts("USB setup failed");
+			timed_out = true;
+		}
+		task_sleep(&timeout_work, 2000);
+#ifdef CONFIG_INTERRUPTS
+		irq_init();
+		irq_request(IRQ_TIMER0, timer_task);
+		irq_request(IRQ_UDC, udc_task);
+		while (!timed_out) {
+			u32 flags;
+
+			/*
+			 * Tasks run with IRQs enabled.  WFI wakes on a
+			 * pending IRQ even while masked, so one raised after
+			 * the idle check is not slept through.
+			 */
+			sched_run();
+			flags = irq_save();
+			if (sched_idle())
+				irq_wfi();
+			irq_restore(flags);
 		}
+		irq_exit();
+#else
+		task_wake(&udc_work);
+		task_wake(&timer_work);
+		while (!timed_out)
+			sched_run();
+#endif
+		mmu_exit();
 		puts("Timeout");
 	}
 
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdbool.h>
+
+#include "linux/list.h"
+
+#include "asm/types.h"
+
+#include "irq.h"
+#include "sched.h"
+#include "timer.h"
+
+/*
+ * Tasks run with IRQs enabled and callbacks may run from interrupts, so
+ * the queues are only touched with IRQs masked.
+ */
+static LIST_HEAD(run_queue);
+static LIST_HEAD(sleep_queue);	/* sorted by wake time */
+static unsigned int runnable;
+static struct task *current;
+
+static void __task_stop(struct task *task)
+{
+	if (list_empty(&task->list))
+		return;
+	if (!task->sleeping)
+		runnable--;
+	list_del_init(&task->list);
+	task->sleeping = false;
+}
+
+static void __task_wake(struct task *task)
+{
+	task->woken = true;
+	if (!list_empty(&task->list) && !task->sleeping)
+		return;
+	__task_stop(task);
+	list_add_tail(&task->list, &run_queue);
+	runnable++;
+}
+
+/* make a stopped or sleeping task runnable, from a task or a callback */
+void task_wake(struct task *task)
+{
+	u32 flags = irq_save();
+
+	__task_wake(task);
+	irq_restore(flags);
+}
+
+/**
+ * task_sleep - take a task off the run queue for a while
+ * @task:     task, usually the one running
+ * @ms:       milliseconds before it is runnable again
+ *
+ * The wakeup is only as precise as msecs, so a task sleeps between ms - 1
+ * and ms milliseconds.  task_wake() ends the sleep early.
+ */
+void task_sleep(struct task *task, unsigned int ms)
+{
+	struct task *pos;
+	u32 flags = irq_save();
+
+	__task_stop(task);
+	task->wake = msecs + ms;
+	task->sleeping = true;
+
+	list_for_each_entry(pos, &sleep_queue, list)
+		if ((int) (pos->wake - task->wake) > 0)
+			break;
+	list_add_tail(&task->list, &pos->list);
+	irq_restore(flags);
+}
+
+/*
+ * Take a task off whichever queue it is on.  A task that was woken while
+ * it ran stays runnable: it checked for work before the callback made
+ * some, and stopping it now would lose the wakeup.
+ */
+void task_stop(struct task *task)
+{
+	u32 flags = irq_save();
+
+	if (task != current || !task->woken)
+		__task_stop(task);
+	irq_restore(flags);
+}
+
+/*
+ * One pass of the main loop: wake the tasks whose time has come, then run
+ * each task that was runnable when the pass started once.  A task may
+ * wake, stop or sleep any task, itself included, while it runs.
+ */
+void sched_run(void)
+{
+	struct task *task;
+	unsigned int n;
+	u32 flags;
+
+	flags = irq_save();
+	while (!list_empty(&sleep_queue)) {
+		task = list_first_entry(&sleep_queue, struct task, list);
+		if ((int) (msecs - task->wake) < 0)
+			break;
+		__task_wake(task);
+	}
+	irq_restore(flags);
+
+	for (n = runnable; n; n--) {
+		flags = irq_save();
+		if (list_empty(&run_queue)) {
+			irq_restore(flags);
+			break;
+		}
+		task = list_first_entry(&run_queue, struct task, list);
+		list_del_init(&task->list);
+		list_add_tail(&task->list, &run_queue);
+		task->woken = false;
+		current = task;
+		irq_restore(flags);
+
+		task->run();
+		current = NULL;
+	}
+}
+
+/*
+ * Nothing is runnable, the main loop may wait for an interrupt.  Check
+ * with IRQs masked, or a callback's wakeup may come just before the wait.
+ */
+bool sched_idle(void)
+{
+	return list_empty(&run_queue);
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _SCHED_H
+#define _SCHED_H
+
+#include <stdbool.h>
+
+#include "linux/list.h"
+
+/*
+ * Cooperative tasks.  A task is a function run from the main loop that
+ * does a bounded slice of work and returns; it is called on every pass
+ * while runnable, until it stops itself or sleeps.  Tasks keep their own
+ * state, usually in a static struct next to the function.
+ */
+struct task {
+	struct list_head	list;	/* on the run or sleep queue */
+	void			(*run)(void);
+	unsigned int		wake;	/* msecs to wake at, while asleep */
+	bool			sleeping;
+	bool			woken;	/* since it last started running */
+};
+
+#define TASK_INIT(name, fn) \
+	{ .list = LIST_HEAD_INIT(name.list), .run = fn }
+
+#define DEFINE_TASK(name, fn) \
+	struct task name = TASK_INIT(name, fn)
+
+void task_wake(struct task *task);
+void task_sleep(struct task *task, unsigned int ms);
+void task_stop(struct task *task);
+void sched_run(void);
+bool sched_idle(void);
+
+#endif /* _SCHED_H */
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <string.h>
+
+#include "asm/types.h"
+
+#include "stats.h"
+#include "timer.h"
+
+struct stats stats __attribute__((aligned(4)));
+
+/* file the time since @start, from stats_start(), into its log2 bucket */
+void stats_time(enum stats_hist h, u32 start)
+{
+	u32 t = timer_ticks_to_ns(timer_ticks() - start) >> STATS_UNIT_SHIFT;
+	unsigned int bucket = 0;
+
+	while (t && bucket < STATS_BUCKETS - 1) {
+		t >>= 1;
+		bucket++;
+	}
+	stats.hist[h][bucket]++;
+}
+
+void stats_reset(void)
+{
+	memset(&stats, 0, sizeof(stats));
+}
+
+/* the header and time stamp are filled in just before the host reads */
+struct stats *stats_snapshot(void)
+{
+	stats.num_stats = NUM_STATS;
+	stats.num_hists = NUM_HISTS;
+	stats.buckets = STATS_BUCKETS;
+	stats.now_us = timer_us();
+	return &stats;
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _STATS_H
+#define _STATS_H
+
+#include "asm/types.h"
+
+/*
+ * Event counters and timing histograms, read by the host with the STATS
+ * vendor request.  Everything here compiles to nothing without
+ * CONFIG_STATS.  The order of both enums is part of the wire format.
+ */
+enum stats_counter {
+	STAT_RESETS,		/* bus resets */
+	STAT_SETUPS,		/* SETUP packets */
+	STAT_OUT_PACKETS,
+	STAT_OUT_BYTES,
+	STAT_IN_PACKETS,
+	STAT_IN_BYTES,
+	STAT_OUT_NO_REQ,	/* OUT packet with no request, host is NAKed */
+	STAT_STALLS,		/* endpoint halts set by the device */
+	STAT_ABORTS,		/* requests ended by udc_nuke_ep() */
+	STAT_BCH_DECODES,	/* sectors with a nonzero syndrome */
+	STAT_BCH_CORRECTED,	/* bits */
+	STAT_BCH_FAILED,	/* uncorrectable sectors */
+	NUM_STATS
+};
+
+enum stats_hist {
+	HIST_FIFO_READ,		/* one OUT packet out of the FIFO */
+	HIST_FIFO_WRITE,	/* one IN packet into the FIFO */
+	HIST_BCH_DECODE,	/* one sector */
+	NUM_HISTS
+};
+
+/*
+ * bucket n counts times of 2^(n-1) to 2^n - 1 units of 128 ns, so from
+ * 128 ns to 2 ms; the last is open
+ */
+#define STATS_BUCKETS		16
+#define STATS_UNIT_SHIFT	7
+
+struct stats {
+	u16 num_stats;
+	u16 num_hists;
+	u16 buckets;
+	u16 reserved;
+	u32 now_us;		/* timer_us() when read */
+	u32 count[NUM_STATS];
+	u32 hist[NUM_HISTS][STATS_BUCKETS];
+} __attribute__((packed));
+
+#ifdef CONFIG_STATS
+#include "timer.h"
+
+extern struct stats stats;
+
+static inline void stats_add(enum stats_counter c, u32 n)
+{
+	stats.count[c] += n;
+}
+
+static inline u32 stats_start(void)
+{
+	return timer_ticks();
+}
+
+void stats_time(enum stats_hist h, u32 start);
+void stats_reset(void);
+struct stats *stats_snapshot(void);
+#else
+static inline void stats_add(enum stats_counter c, u32 n)
+{
+}
+
+static inline u32 stats_start(void)
+{
+	return 0;
+}
+
+static inline void stats_time(enum stats_hist h, u32 start)
+{
+}
+#endif
+
+#define stats_inc(c)		stats_add(c, 1)
+
+#endif /* _STATS_H */
@@ -16,31 +16,128 @@
  */
 
 #include "asm/io.h"
+#include "asm/types.h"
 #include "mach/timer.h"
 
+#include "irq.h"
+#include "timer.h"
+
+#ifdef CONFIG_INTERRUPTS
+#define TIMER_CONTROL_IRQ	TIMER_CONTROL_INTENB
+#else
+#define TIMER_CONTROL_IRQ	0
+#endif
+
+/*
+ * TIMER0 restarts every millisecond from PLL1 / 147 and only provides the
+ * tick interrupt.  TIMER1 runs freely from PLL1 itself and is the
+ * timebase: msecs and timer_now() are both derived from its count, so a
+ * tick that is serviced late is not lost.
+ */
+#define TICKS_PER_MS		(TIMER_HZ / 1000)
+
 static void __iomem *timer0 = (void __iomem *) TIMER0_BASE;
+static void __iomem *timer1 = (void __iomem *) TIMER1_BASE;
 unsigned int msecs;
 
+static u32 msecs_start;		/* count at which msecs last advanced */
+static u32 now_last, now_high;	/* 64-bit extension of the count */
+
+static void timer_setup(void __iomem *timer, unsigned int div, u32 match,
+		u32 control)
+{
+	writel(TIMER_CLKENB_TCLKMODE | TIMER_CLKENB_CLKGENENB,
+			timer + TIMER_CLKENB);
+	writel(TIMER_CLKGEN_CLKDIV(div - 1) | TIMER_CLKGEN_CLKSRCSEL_PLL1,
+			timer + TIMER_CLKGEN);
+	writel(TIMER_CONTROL_RUN, timer + TIMER_CONTROL);
+	writel(0, timer + TIMER_COUNT);
+	writel(match, timer + TIMER_MATCH);
+	writel(TIMER_CONTROL_SELTCLK_1 | TIMER_CONTROL_RUN | control,
+			timer + TIMER_CONTROL);
+}
+
 void timer_init(void)
 {
 	msecs = 0;
+	msecs_start = 0;
+	now_last = 0;
+	now_high = 0;
 
-	writel(TIMER_CLKENB_TCLKMODE | TIMER_CLKENB_CLKGENENB,
-			timer0 + TIMER_CLKENB);
-	writel(TIMER_CLKGEN_CLKDIV(146) | TIMER_CLKGEN_CLKSRCSEL_PLL1,
-			timer0 + TIMER_CLKGEN);
-	writel(TIMER_CONTROL_RUN, timer0 + TIMER_CONTROL);
-	writel(0, timer0 + TIMER_COUNT);
-	writel(999, timer0 + TIMER_MATCH);
-	writel(TIMER_CONTROL_SELTCLK_1 | TIMER_CONTROL_RUN,
-			timer0 + TIMER_CONTROL);
+	timer_setup(timer1, 1, ~0u, 0);
+	timer_setup(timer0, 147, 999, TIMER_CONTROL_IRQ);
 }
 
+/**
+ * timer_ticks - read the free-running count
+ *
+ * The counter is latched into TIMER_COUNT by LDCNT before it is read.
+ * It wraps every 29 seconds; differences of two reads as u32 are right
+ * across the wrap.  timer_ticks_to_us() and timer_ticks_to_ns() convert
+ * such a difference.
+ *
+ * Returns:
+ *  TIMER_HZ ticks, modulo 2^32
+ */
+u32 timer_ticks(void)
+{
+	u32 control = readl(timer1 + TIMER_CONTROL);
+
+	/* INTPEND is write-one-to-clear, leave it alone */
+	control &= ~TIMER_CONTROL_INTPEND;
+	writel(control | TIMER_CONTROL_LDCNT, timer1 + TIMER_CONTROL);
+	return readl(timer1 + TIMER_COUNT);
+}
+
+/**
+ * timer_now - ticks since timer_init()
+ *
+ * Wraps of the 32-bit count are caught by comparing with the previous
+ * read, so this or timer_task() has to run at least every 29 seconds.
+ */
+u64 timer_now(void)
+{
+	u32 flags = irq_save();
+	u32 now = timer_ticks();
+	u64 ret;
+
+	if (now < now_last)
+		now_high++;
+	now_last = now;
+	ret = ((u64) now_high << 32) | now;
+
+	irq_restore(flags);
+	return ret;
+}
+
+/**
+ * timer_us - microseconds since timer_init(), modulo 2^32
+ *
+ * Whole milliseconds come from msecs, the rest from the ticks since it
+ * last advanced, so this wraps every 71 minutes like a 1 MHz count.
+ */
+u32 timer_us(void)
+{
+	u32 flags = irq_save();
+	u32 us = msecs * 1000 + timer_ticks_to_us(timer_ticks() - msecs_start);
+
+	irq_restore(flags);
+	return us;
+}
+
+/* polled from the main loop, or the TIMER0 interrupt handler */
 void timer_task(void)
 {
 	u32 tmp = readl(timer0 + TIMER_CONTROL);
-	if (tmp & TIMER_CONTROL_INTPEND) {
+	u32 now;
+
+	if (tmp & TIMER_CONTROL_INTPEND)
 		writel(tmp, timer0 + TIMER_CONTROL);
+
+	/* catch up on every millisecond since the last call */
+	now = (u32) timer_now();
+	while (now - msecs_start >= TICKS_PER_MS) {
+		msecs_start += TICKS_PER_MS;
 		msecs++;
 	}
 }
@@ -15,7 +15,38 @@
  * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#ifndef _TIMER_H
+#define _TIMER_H
+
+#include "asm/types.h"
+
+/* TIMER1 counts PLL1 undivided, nominally 147 MHz: one tick is 6.8 ns */
+#define TIMER_HZ		147000000
+
+/* 2^32 us and 2^24 ns per tick, rounded up, for the conversions below */
+#define TIMER_US_SCALE		((u32) (((1000000ULL << 32) + TIMER_HZ - 1) / \
+					TIMER_HZ))
+#define TIMER_NS_SCALE		((u32) (((1000000000ULL << 24) + TIMER_HZ - 1) / \
+					TIMER_HZ))
+
 extern unsigned int msecs;
 
 void timer_init(void);
 void timer_task(void);
+u32 timer_ticks(void);
+u64 timer_now(void);
+u32 timer_us(void);
+
+/* a difference of two timer_ticks() reads in microseconds */
+static inline u32 timer_ticks_to_us(u32 ticks)
+{
+	return ((u64) ticks * TIMER_US_SCALE) >> 32;
+}
+
+/* the same in nanoseconds, for differences up to 4.2 s */
+static inline u32 timer_ticks_to_ns(u32 ticks)
+{
+	return ((u64) ticks * TIMER_NS_SCALE) >> 24;
+}
+
+#endif /* _TIMER_H */
@@ -28,14 +28,28 @@
 #include "linux/usb/ch9.h"
 
 #include "udc.h"
-
-#define ESHUTDOWN 108
+#include "crc32.h"
+#include "irq.h"
+#include "stats.h"
+#include "udc_fifo.h"
+#include "udc_pool.h"
+#ifdef CONFIG_UDC_DMA
+#include "dma.h"
+#endif
 
 static struct udc _udc;
 
+/* GET_STATUS replies, the one request the core queues itself */
+static struct udc_req *status_req;
+
 #define ep_index(_ep)		((_ep)->address & USB_ENDPOINT_NUMBER_MASK)
 #define ep_is_in(_ep)		((_ep)->address & USB_DIR_IN)
 
+/*
+ * Selects the endpoint behind the indexed registers.  udc_task() may run
+ * from the UDC interrupt, so the endpoint ops mask IRQs across the select
+ * and the accesses that follow it.
+ */
 static inline void set_index(struct udc *udc, int addr)
 {
 	addr &= USB_ENDPOINT_NUMBER_MASK;
@@ -67,6 +81,7 @@ static void udc_nuke_ep(struct udc_ep *ep, int status)
 		req = list_entry(ep->queue.next,
 				struct udc_req, queue);
 		udc_complete_req(ep, req, status);
+		stats_inc(STAT_ABORTS);
 	}
 }
 
@@ -84,6 +99,7 @@ static inline int udc_read_setup_pkt(struct udc *udc, u16 *buf)
 			*buf++ = word;
 	}
 	writew(UDC_EP0SR_RX_SUCCESS, udc->regs + UDC_EP0SR);
+	stats_inc(STAT_SETUPS);
 
 	return count;
 }
@@ -91,29 +107,23 @@ static inline int udc_read_setup_pkt(struct udc *udc, u16 *buf)
 static int udc_write_fifo(struct udc_ep *ep, struct udc_req *req)
 {
 	struct udc *udc = ep->dev;
-	void __iomem *fifo = ep->fifo;
-	u16 *buf;
 	u32 max = ep->maxpacket;
-	u32 count, length;
+	u32 length, start;
 	bool is_last;
 
-	buf = req->buf + req->actual;
 	length = req->length - req->actual;
 	length = min(length, max);
-	req->actual += length;
 
+	start = stats_start();
 	writew(length, udc->regs + UDC_BWCR);
-	for (count = 0; count < length; count += 2)
-		writew(*buf++, fifo);
+	udc_fifo_write(ep->fifo, req->buf + req->actual, length);
+	req->actual += length;
+	stats_time(HIST_FIFO_WRITE, start);
+	stats_inc(STAT_IN_PACKETS);
+	stats_add(STAT_IN_BYTES, length);
 
-	if (length != max) {
-		is_last = true;
-	} else {
-		if (req->length != req->actual || req->zero)
-			is_last = false;
-		else
-			is_last = true;
-	}
+	is_last = (length != max) ||
+			(req->length == req->actual && !req->zero);
 
 	if (is_last)
 		udc_complete_req(ep, req, 0);
@@ -121,43 +131,117 @@ static int udc_write_fifo(struct udc_ep *ep, struct udc_req *req)
 	return is_last;
 }
 
-static int udc_read_fifo(struct udc_ep *ep, struct udc_req *req)
+#ifdef CONFIG_UDC_DMA
+/*
+ * Hand a full packet to the DMA engine.  Short packets, the tail of a
+ * request and unaligned destinations are left to the PIO path.
+ */
+static bool udc_dma_read(struct udc_ep *ep, struct udc_req *req, u16 esr)
+{
+	struct udc *udc = ep->dev;
+	void *buf = req->buf + req->actual;
+	int length;
+
+	length = readw(udc->regs + UDC_BRCR) * 2;
+	if (esr & UDC_ESR_LWO)
+		length -= 1;
+
+	if (length != ep->maxpacket ||
+			req->length - req->actual < (unsigned int) length ||
+			((unsigned long) buf & 3))
+		return false;
+
+	dma_inv_range(buf, length);
+
+	writew(length, udc->regs + UDC_DFCR);
+	writew(UDC_DCR_DEN | UDC_DCR_RDR, udc->regs + UDC_DCR);
+	dma_io_to_mem(DMA_CHANNEL_UDC,
+			(u32)(unsigned long) ep->fifo, DMA_REQ_UDC, buf, length);
+	ep->dma_len = length;
+	return true;
+}
+
+static void udc_epout_intr(struct udc *udc, struct udc_ep *ep);
+
+static void udc_dma_poll(struct udc *udc)
+{
+	struct udc_ep *ep;
+	struct udc_req *req;
+	u8 epnum;
+
+	for (epnum = 1; epnum < NUM_ENDPOINTS; epnum++) {
+		ep = &udc->ep[epnum];
+		if (!ep->dma_len || dma_busy(DMA_CHANNEL_UDC))
+			continue;
+
+		set_index(udc, epnum);
+		writew(0, udc->regs + UDC_DCR);
+
+		if (!list_empty(&ep->queue)) {
+			req = list_entry(ep->queue.next,
+					struct udc_req, queue);
+			if (req->crc)
+				*req->crc = crc32(*req->crc,
+						req->buf + req->actual,
+						ep->dma_len);
+			req->actual += ep->dma_len;
+			if (req->actual == req->length)
+				udc_complete_req(ep, req, 0);
+		}
+		ep->dma_len = 0;
+
+		/* pick up whatever arrived while the channel was busy */
+		udc_epout_intr(udc, ep);
+	}
+}
+#endif
+
+/*
+ * Read one packet into @req.  @esr is the endpoint status the caller has
+ * already fetched (EP0SR for ep0).  Returns 1 when the request completed,
+ * 0 when more data is expected, or a negative error if nothing was read.
+ */
+static int udc_read_fifo(struct udc_ep *ep, struct udc_req *req, u16 esr)
 {
 	struct udc *udc = ep->dev;
 	void __iomem *fifo = ep->fifo;
-	u16 *buf, word;
-	int buflen, count, length, bytes;
-	u32 offset;
-	u16 esr;
-	int is_last = 0;
+	unsigned int count, length, bytes;
+	u32 start;
+	int is_last;
 
-	offset = ep_index(ep) ? UDC_ESR : UDC_EP0SR;
-	esr = readw(udc->regs + offset);
 	if (!(esr & UDC_ESR_RX_SUCCESS))
 		return -EINVAL;
 
-	buf = req->buf + req->actual;
-	buflen = req->length - req->actual;
+#ifdef CONFIG_UDC_DMA
+	if (ep->dma && (ep->dma_len || udc_dma_read(ep, req, esr)))
+		return -EBUSY;
+#endif
 
+	start = stats_start();
 	count = readw(udc->regs + UDC_BRCR);
 	length = count * 2;
 	if (esr & (ep_index(ep) ? UDC_ESR_LWO : UDC_EP0SR_EP0_LWO))
 		length -= 1;
 
-	bytes = min(length, buflen);
+	bytes = req->length - req->actual;
+	if (bytes > length)
+		bytes = length;
 
+	if (req->crc)
+		udc_fifo_read_crc(fifo, req->buf + req->actual, bytes,
+				req->crc);
+	else
+		udc_fifo_read(fifo, req->buf + req->actual, bytes);
 	req->actual += bytes;
-	is_last = (length < ep->maxpacket);
 
-	while (count--) {
-		word = readw(fifo);
-		if (buflen) {
-			*buf++ = word;
-			buflen -= 2;
-		} else {
-			req->status = -EOVERFLOW;
-		}
-	}
+	/* drop whatever did not fit in the request */
+	for (count -= (bytes + 1) / 2; count; count--)
+		readw(fifo);
+	stats_time(HIST_FIFO_READ, start);
+	stats_inc(STAT_OUT_PACKETS);
+	stats_add(STAT_OUT_BYTES, length);
+
+	is_last = (length < ep->maxpacket);
 
 	if (!ep_index(ep)) {
 		writew(UDC_ESR_RX_SUCCESS, udc->regs + UDC_EP0SR);
@@ -174,6 +258,23 @@ static int udc_read_fifo(struct udc_ep *ep, struct udc_req *req)
 	return is_last;
 }
 
+/*
+ * Drain every packet the controller holds for an OUT endpoint, moving on
+ * to the next queued request whenever one completes.
+ */
+static void udc_drain_fifo(struct udc_ep *ep, u16 esr)
+{
+	struct udc_req *req;
+
+	while ((esr & UDC_ESR_RX_SUCCESS) && !list_empty(&ep->queue)) {
+		req = list_entry(ep->queue.next,
+				struct udc_req, queue);
+		if (udc_read_fifo(ep, req, esr) < 0)
+			break;
+		esr = readw(ep->dev->regs + UDC_ESR);
+	}
+}
+
 static inline void udc_epin_intr(struct udc *udc, struct udc_ep *ep)
 {
 	struct udc_req *req;
@@ -197,9 +298,8 @@ static inline void udc_epin_intr(struct udc *udc, struct udc_ep *ep)
 	}
 }
 
-static inline void udc_epout_intr(struct udc *udc, struct udc_ep *ep)
+static void udc_epout_intr(struct udc *udc, struct udc_ep *ep)
 {
-	struct udc_req *req;
 	u16 esr;
 	u16 ecr;
 
@@ -215,32 +315,32 @@ static inline void udc_epout_intr(struct udc *udc, struct udc_ep *ep)
 		writew(ecr, udc->regs + UDC_ECR);
 	}
 
-	if (esr & UDC_ESR_RX_SUCCESS) {
-		if (list_empty(&ep->queue))
-			return;
+	/* the packet waits in the FIFO, NAKing the host, until a request */
+	if ((esr & UDC_ESR_RX_SUCCESS) && list_empty(&ep->queue))
+		stats_inc(STAT_OUT_NO_REQ);
 
-		req = list_entry(ep->queue.next,
-				struct udc_req, queue);
-		if (!udc_read_fifo(ep, req) && (esr & UDC_ESR_PSIF_TWO))
-			udc_read_fifo(ep, req);
-	}	
+	udc_drain_fifo(ep, esr);
 }
 
 static int udc_set_halt(struct udc_ep *ep, bool halt)
 {
 	struct udc *udc = ep->dev;
 	struct udc_req *req;
+	u32 offset, flags;
 	u16 ecr;
-	u32 offset;
 
-	if (halt && ep_is_in(ep) && !list_empty(&ep->queue))
+	flags = irq_save();
+	if (halt && ep_is_in(ep) && !list_empty(&ep->queue)) {
+		irq_restore(flags);
 		return -EAGAIN;
+	}
 
 	set_index(udc, ep->address);
 	offset = ep_index(ep) ? UDC_ECR : UDC_EP0CR;
 
 	ecr = readw(udc->regs + offset);
 	if (halt) {
+		stats_inc(STAT_STALLS);
 		ecr |= UDC_ECR_STALL;
 		if (ep_index(ep))
 			ecr |= UDC_ECR_FLUSH;
@@ -257,6 +357,7 @@ static int udc_set_halt(struct udc_ep *ep, bool halt)
 		if (req)
 			udc_write_fifo(ep, req);
 	}
+	irq_restore(flags);
 	return 0;
 }
 
@@ -270,7 +371,7 @@ static inline int udc_process_req_feature(struct udc *udc,
 	if (ctrl->bRequestType == USB_RECIP_ENDPOINT) {
 		switch (ctrl->wValue) {
 		case USB_ENDPOINT_HALT:
-			if (epnum > NUM_ENDPOINTS)
+			if (epnum >= NUM_ENDPOINTS)
 				return -1;
 			ep = &udc->ep[epnum];
 			udc_set_halt(ep, set);
@@ -285,34 +386,30 @@ static inline int udc_process_req_feature(struct udc *udc,
 static inline int udc_process_req_status(struct udc *udc,
 		struct usb_ctrlrequest *ctrl)
 {
-	struct udc_req req;
+	struct udc_req *req = status_req;
 	struct udc_ep *ep0 = &udc->ep[0];
-	u16 reply;
+	u16 *reply = req->buf;
 	u8 epnum;
 
-	bzero(&req, sizeof(req));
-
 	switch (ctrl->bRequestType & USB_RECIP_MASK) {
 	case USB_RECIP_DEVICE:
-		reply = (1 << USB_DEVICE_SELF_POWERED);
+		*reply = (1 << USB_DEVICE_SELF_POWERED);
 		break;
 
 	case USB_RECIP_INTERFACE:
-		reply = 0;
+		*reply = 0;
 		break;
 
 	case USB_RECIP_ENDPOINT:
 		epnum = ctrl->wIndex & USB_ENDPOINT_NUMBER_MASK;
-		if (epnum > NUM_ENDPOINTS)
+		if (epnum >= NUM_ENDPOINTS)
 			return -1;
-		reply = udc->ep[epnum].stopped ? 1 : 0;
+		*reply = udc->ep[epnum].stopped ? 1 : 0;
 		break;
 	}
 
-	INIT_LIST_HEAD(&req.queue);
-	req.length = 2;
-	req.buf = &reply;
-	udc_write_fifo(ep0, &req);
+	req->length = 2;
+	ep0->ops->queue(ep0, req);
 	return 0;
 }
 
@@ -423,7 +520,7 @@ static void udc_ep0_intr(struct udc *udc)
 				return;
 			req = list_entry(ep0->queue.next,
 					struct udc_req, queue);
-			udc_read_fifo(ep0, req);
+			udc_read_fifo(ep0, req, esr);
 		}
 	}
 }
@@ -432,14 +529,16 @@ static int udc_enable_ep(struct udc_ep *ep,
 		const struct usb_endpoint_descriptor *desc)
 {
 	struct udc *udc;
+	u32 flags;
 	u16 ecr;
 	u16 eier;
 	u16 edr;
 
 	udc = ep->dev;
+	flags = irq_save();
 	set_index(udc, ep->address);
 	edr = readw(udc->regs + UDC_EDR);
-	if (ep_is_in(ep)) {
+	if (usb_endpoint_dir_in(desc)) {
 		ep->address |= USB_DIR_IN;
 		edr |= 1 << ep_index(ep);
 	} else {
@@ -453,11 +552,15 @@ static int udc_enable_ep(struct udc_ep *ep,
 	writew(ecr, udc->regs + UDC_ECR);
 
 	ep->maxpacket = desc->wMaxPacketSize;
+#ifdef CONFIG_UDC_DMA
+	ep->dma = !ep_is_in(ep) && usb_endpoint_xfer_bulk(desc);
+#endif
 	udc_set_halt(ep, 0);
 
 	eier = readw(udc->regs + UDC_EIER);
 	eier |= 1 << ep_index(ep);
 	writew(eier, udc->regs + UDC_EIER);
+	irq_restore(flags);
 
 	return 0;
 }
@@ -465,6 +568,7 @@ static int udc_enable_ep(struct udc_ep *ep,
 static int udc_disable_ep(struct udc_ep *ep)
 {
 	struct udc *udc;
+	u32 flags;
 	u16 eier;
 
 	if (!ep)
@@ -472,13 +576,23 @@ static int udc_disable_ep(struct udc_ep *ep)
 
 	udc = ep->dev;
 
+	flags = irq_save();
 	set_index(udc, ep->address);
 	eier = readw(udc->regs + UDC_EIER);
-	eier &= ~ep_index(ep);
+	eier &= ~(1 << ep_index(ep));
 	writew(eier, udc->regs + UDC_EIER);
 
+#ifdef CONFIG_UDC_DMA
+	if (ep->dma_len) {
+		dma_stop(DMA_CHANNEL_UDC);
+		writew(0, udc->regs + UDC_DCR);
+		ep->dma_len = 0;
+	}
+#endif
+
 	udc_nuke_ep(ep, -ESHUTDOWN);
 	ep->stopped = 1;
+	irq_restore(flags);
 
 	return 0;
 }
@@ -486,10 +600,11 @@ static int udc_disable_ep(struct udc_ep *ep)
 static int udc_queue(struct udc_ep *ep, struct udc_req *req)
 {
 	struct udc *udc;
-	u32 offset;
+	u32 offset, flags;
 	u16 esr;
 
 	udc = ep->dev;
+	flags = irq_save();
 	set_index(udc, ep->address);
 
 	req->status = -EINPROGRESS;
@@ -499,7 +614,7 @@ static int udc_queue(struct udc_ep *ep, struct udc_req *req)
 		ep->address &= ~USB_DIR_IN;
 		udc->ep0_state = WAIT_FOR_SETUP;
 		udc_complete_req(ep, req, 0);
-		return 0;
+		goto out;
 	}
 
 	if (list_empty(&ep->queue) && !ep->stopped) {
@@ -509,23 +624,55 @@ static int udc_queue(struct udc_ep *ep, struct udc_req *req)
 			if (!(esr & UDC_ESR_TX_SUCCESS) &&
 					(udc_write_fifo(ep, req) == 1))
 				req = NULL;
-		} else {
-			if ((esr & UDC_ESR_RX_SUCCESS) &&
-					(udc_read_fifo(ep, req) == 1))
+		} else if (!ep_index(ep)) {
+			if (udc_read_fifo(ep, req, esr) == 1)
 				req = NULL;
+		} else {
+			list_add_tail(&req->queue, &ep->queue);
+			udc_drain_fifo(ep, esr);
+			goto out;
 		}
 	}
 
 	if (req)
 		list_add_tail(&req->queue, &ep->queue);
-
+out:
+	irq_restore(flags);
 	return 0;
 }
 
+static int udc_dequeue(struct udc_ep *ep, struct udc_req *req)
+{
+	struct udc_req *r;
+	u32 flags;
+	int ret = -EINVAL;
+
+	flags = irq_save();
+	list_for_each_entry(r, &ep->queue, queue) {
+		if (r == req) {
+#ifdef CONFIG_UDC_DMA
+			/* the head request may be the DMA destination */
+			if (ep->dma_len && ep->queue.next == &req->queue) {
+				set_index(ep->dev, ep->address);
+				dma_stop(DMA_CHANNEL_UDC);
+				writew(0, ep->dev->regs + UDC_DCR);
+				ep->dma_len = 0;
+			}
+#endif
+			udc_complete_req(ep, req, -ECONNRESET);
+			ret = 0;
+			break;
+		}
+	}
+	irq_restore(flags);
+	return ret;
+}
+
 static struct udc_ep_ops udc_ep_ops = {
 	.enable = udc_enable_ep,
 	.disable = udc_disable_ep,
 	.queue = udc_queue,
+	.dequeue = udc_dequeue,
 	.set_halt = udc_set_halt,
 };
 
@@ -533,13 +680,16 @@ static void udc_init_ep(struct udc *udc, u8 epnum)
 {
 	struct udc_ep *ep;
 
-	if (epnum > NUM_ENDPOINTS)
+	if (epnum >= NUM_ENDPOINTS)
 		return;
 
 	ep = &udc->ep[epnum];
 
 	ep->address = epnum;
 
+	/* requests left over from before a bus reset are aborted */
+	if (ep->queue.next)
+		udc_nuke_ep(ep, -ESHUTDOWN);
 	INIT_LIST_HEAD(&ep->queue);
 
 	ep->ops = &udc_ep_ops;
@@ -551,6 +701,12 @@ static void udc_init_ep(struct udc *udc, u8 epnum)
 
 	ep->fifo = udc->regs + UDC_BR(epnum);
 	ep->stopped = 0;
+#ifdef CONFIG_UDC_DMA
+	if (ep->dma_len)
+		dma_stop(DMA_CHANNEL_UDC);
+#endif
+	ep->dma = 0;
+	ep->dma_len = 0;
 
 	set_index(udc, epnum);
 	writew(ep->maxpacket, udc->regs + UDC_MPR);
@@ -581,6 +737,10 @@ void udc_task(void)
 	u16 sys_status;
 	u8 epnum;
 
+#ifdef CONFIG_UDC_DMA
+	udc_dma_poll(udc);
+#endif
+
 	sys_status = readw(udc->regs + UDC_SSR);
 	ep_intr = readw(udc->regs + UDC_EIR);
 
@@ -601,6 +761,14 @@ void udc_task(void)
 		if (sys_status & UDC_SSR_ERR)
 			writew(UDC_SSR_ERR, udc->regs + UDC_SSR);
 
+		/* a reset seen together with speed detection came first */
+		if (sys_status & UDC_SSR_RESET) {
+			writew(UDC_SSR_RESET, udc->regs + UDC_SSR);
+			stats_inc(STAT_RESETS);
+			udc_reconfig(udc);
+			udc->state = USB_STATE_ATTACHED;
+		}
+
 		if (sys_status & UDC_SSR_SDE) {
 			writew(UDC_SSR_SDE, udc->regs + UDC_SSR);
 			udc->speed = (sys_status & UDC_SSR_HSP) ?
@@ -614,12 +782,6 @@ void udc_task(void)
 
 		if (sys_status & UDC_SSR_RESUME)
 			writew(UDC_SSR_RESUME, udc->regs + UDC_SSR);
-
-		if (sys_status & UDC_SSR_RESET) {
-			writew(UDC_SSR_RESET, udc->regs + UDC_SSR);
-			udc_reconfig(udc);
-			udc->state = USB_STATE_ATTACHED;
-		}
 	}
 
 	if (ep_intr & UDC_EP0) {
@@ -669,11 +831,23 @@ int udc_init(struct udc_driver *driver)
 
 	udc_reconfig(udc);
 
+	/*
+	 * Requests left from an earlier run were aborted above, so every
+	 * request and buffer can be handed out again.
+	 */
+	udc_pool_init();
+	status_req = udc_req_alloc(NULL);
+	if (!status_req)
+		return -ENOMEM;
+	status_req->buf = udc_buf_alloc(sizeof(u16));
+	if (!status_req->buf)
+		return -ENOMEM;
+
 	/* enable VBUS detection */
 	writew(UDC_USER1_VBUSENB, udc->regs + UDC_USER1);
 
 	if (udc->driver->init)
-		udc->driver->init(udc);
+		return udc->driver->init(udc);
 
 	return 0;
 }
@@ -25,7 +25,16 @@
 
 #include "linux/usb/ch9.h"
 
-#define NUM_ENDPOINTS 2
+#define NUM_ENDPOINTS 3
+
+/*
+ * Status of an aborted request: -ECONNRESET after its owner's own
+ * dequeue(), -ESHUTDOWN when the endpoint went away under it with a bus
+ * reset or a disable.
+ */
+#ifndef ESHUTDOWN
+#define ESHUTDOWN 108
+#endif
 
 struct udc;
 struct udc_ep;
@@ -40,7 +49,7 @@ enum ep0_state {
 };
 
 struct udc_driver {
-	void			(*init)(struct udc *udc);
+	int			(*init)(struct udc *udc);
 	int			(*setup)(struct udc *udc,
 					struct usb_ctrlrequest *ctrl);
 };
@@ -50,9 +59,11 @@ struct udc_req {
 	unsigned int		length;
 	unsigned int		actual;
 	bool			zero;
+	u32			*crc;
 	void			(*complete)(struct udc_ep *ep,
 					struct udc_req *req);
 	int			status;
+	void			*context;
 	struct list_head	queue;
 };
 
@@ -72,6 +83,8 @@ struct udc_ep {
 	u8			address;
 	u8			stopped;
 	u16			maxpacket;
+	u8			dma;
+	u16			dma_len;
 	struct udc		*dev;
 	struct udc_ep_ops	*ops;
 	struct list_head	queue;
@@ -15,7 +15,9 @@
  * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <errno.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -23,23 +25,36 @@
 #include "baremetal/cache.h"
 #include "baremetal/util.h"
 
+#include "bch.h"
+#include "crc32.h"
+#include "irq.h"
+#include "lz4.h"
+#include "mmu.h"
+#include "nand.h"
+#include "sched.h"
+#include "stats.h"
 #include "udc.h"
+#include "udc_driver.h"
+#include "udc_pool.h"
 #include "descriptors.h"
 
-static struct udc_req setup_req = {0};
-static struct udc_req buffer_req = {0};
+/* EP0 replies and OUT data, from the request pool */
+static struct udc_req *setup_req;
 
 extern bool timeout_aborted;
 
 static int process_req_vendor(struct udc *udc,	struct usb_ctrlrequest *ctrl);
+static int bulk_enable(struct udc *udc, bool on);
+static void drop_transfers(void);
 
 static inline int process_req_desc(struct udc *udc,
 		struct usb_ctrlrequest *ctrl)
 {
 	struct udc_ep *ep0 = &udc->ep[0];
-	struct udc_req *req = &setup_req;
+	struct udc_req *req = setup_req;
 	int i;
 
+	udc_req_reset(req);
 	switch (ctrl->wValue >> 8) {
 	case USB_DT_DEVICE:
 		if (udc->speed == USB_SPEED_HIGH) {
@@ -100,7 +115,6 @@ static inline int process_req_desc(struct udc *udc,
 		return -1;
 	}
 
-	INIT_LIST_HEAD(&req->queue);
 	req->length = min((u32)ctrl->wLength, req->length);
 	ep0->ops->queue(ep0, req);
 	return 0;
@@ -109,16 +123,23 @@ static inline int process_req_desc(struct udc *udc,
 static inline void set_config(struct udc *udc, int config)
 {
 	struct udc_ep *ep1 = &udc->ep[1];
-	struct usb_endpoint_descriptor *ep1_descriptor;
+	struct udc_ep *ep2 = &udc->ep[2];
+	struct usb_device_config_descriptor *desc;
 
 	if (udc->speed == USB_SPEED_HIGH)
-		ep1_descriptor = &hs_config_descriptor.ep1;
+		desc = &hs_config_descriptor;
 	else
-		ep1_descriptor = &fs_config_descriptor.ep1;
+		desc = &fs_config_descriptor;
 
+	/* commands go back to control transfers until asked again */
+	bulk_enable(udc, false);
 	ep1->ops->disable(ep1);
-	if (config)
-		ep1->ops->enable(ep1, ep1_descriptor);
+	ep2->ops->disable(ep2);
+	drop_transfers();
+	if (config) {
+		ep1->ops->enable(ep1, &desc->ep1);
+		ep2->ops->enable(ep2, &desc->ep2);
+	}
 	udc->config = config;
 }
 
@@ -126,14 +147,14 @@ static inline int process_req_config(struct udc *udc,
 		struct usb_ctrlrequest *ctrl)
 {
 	struct udc_ep *ep0 = &udc->ep[0];
-	struct udc_req *req = &setup_req;
+	struct udc_req *req = setup_req;
 
 	if (ctrl->bRequest == USB_REQ_SET_CONFIGURATION) {
 		if (ctrl->wValue > NUM_CONFIG_DESC)
 			return -1;
 		set_config(udc, ctrl->wValue);
 	} else {
-		bzero(req, sizeof(*req));
+		udc_req_reset(req);
 		req->buf = &udc->config;
 		req->length = 1;
 		ep0->ops->queue(ep0, req);
@@ -145,19 +166,17 @@ static inline int process_req_iface(struct udc *udc,
 		struct usb_ctrlrequest *ctrl)
 {
 	struct udc_ep *ep0 = &udc->ep[0];
-	struct udc_req *req = &setup_req;
+	struct udc_req *req = setup_req;
 	u8 interface = ctrl->wIndex & 0xff;
 	u8 alternate = ctrl->wValue & 0xff;
-	u16 reply;
+	static u8 setting;	/* only alternate setting 0 exists */
 
 	if (ctrl->bRequest == USB_REQ_SET_INTERFACE) {
 		if (interface || alternate)
 			return -1;
 	} else {
-		bzero(req, sizeof(*req));
-		INIT_LIST_HEAD(&req->queue);
-		reply = 0;
-		req->buf = &reply;
+		udc_req_reset(req);
+		req->buf = &setting;
 		req->length = 1;
 		ep0->ops->queue(ep0, req);
 	}
@@ -193,7 +212,16 @@ static int process_setup(struct udc *udc, struct usb_ctrlrequest *ctrl)
 	return -1;
 }
 
+static int driver_alloc(void);
+
+static int driver_init(struct udc *udc)
+{
+	crc32_init();
+	return driver_alloc();
+}
+
 struct udc_driver udc_driver = {
+	.init = driver_init,
 	.setup = process_setup,
 };
 
@@ -201,51 +229,1326 @@ struct udc_driver udc_driver = {
 /* Application specific code                                              */
 /**************************************************************************/
 
+#define CMD_BUF_SIZE 256
+
 static u16 cmd;
-static u8 buf[8];
+static u8 *buf;
+
+/*
+ * LOAD requests are taken from a ring so the host can queue several
+ * before streaming their data, keeping EP1 armed back to back.  Requests
+ * complete in queue order, so the slot after the newest is always the
+ * oldest one.
+ */
+#define NUM_LOAD_REQS 4
+
+static struct udc_req *load_reqs[NUM_LOAD_REQS];
+static unsigned int load_head;
+static unsigned int load_busy;
+
+/* CRC-32 and length of LOAD data, summed packet by packet on receive */
+static u32 load_crc;
+static u32 load_length;
 
 enum commands {
 	COMMAND_LOAD = 0,
 	COMMAND_RUN,
+	COMMAND_NAND_PROGRAM,
+	COMMAND_NAND_STATUS,
+	COMMAND_NAND_DUMP,
+	COMMAND_LOAD_CRC,
+	COMMAND_LOAD_LZ4,
+	COMMAND_LOAD_SPARSE,
+	COMMAND_LOAD_SG,
+	COMMAND_STATS,
+	COMMAND_BULK,
 };
 
+/* wire format, addresses are always 32-bit */
 struct load_data {
-	void *addr;
+	u32 addr;
 	u32 length;
 };
 
 struct run_data {
-	void (*f)(void);
+	u32 addr;
 };
 
-static void command_data(struct udc_ep *ep, struct udc_req *req)
+/* NAND_PROGRAM and NAND_DUMP */
+struct nand_data {
+	u32 page;
+	u32 count;
+};
+
+struct load_crc_data {
+	u32 crc;
+	u32 length;
+	u32 pending;
+};
+
+struct nand_status_data {
+	u32 remaining;
+	u32 failed_page;
+	u32 corrected;
+};
+
+/*
+ * LOAD_SG sends a table of load_data segments over EP0, then all their
+ * data as one bulk stream.  The host pads each segment to whole packets,
+ * so every one starts on a packet boundary; the pad is dropped as it does
+ * not fit the request.  The ring is refilled from
+ * the completion callback, so EP1 never runs out of requests.
+ */
+#define LOAD_SG_MAX (CMD_BUF_SIZE / sizeof(struct load_data))
+
+static struct load_data sg[LOAD_SG_MAX];
+static unsigned int sg_next;
+static unsigned int sg_count;
+
+/*
+ * NAND programming streams pages from EP1 into two page buffers.  While
+ * the chip programs one buffer, the other receives the next page and has
+ * its parity computed, so USB reception, ECC and the array program time
+ * all overlap.  Blocks are erased as programming enters them.
+ *
+ * Dumping runs the same buffers the other way: while one page is being
+ * sent on EP2, the chip reads the next one, which is then corrected.
+ */
+#define NUM_PAGE_BUFS 2
+
+enum page_buf_state {
+	PAGE_BUF_FREE = 0,
+	PAGE_BUF_RECEIVING,
+	PAGE_BUF_FULL,
+	PAGE_BUF_READY,
+	PAGE_BUF_SENDING,
+	PAGE_BUF_ERROR,
+};
+
+enum prog_nand_state {
+	PROG_NAND_IDLE = 0,
+	PROG_NAND_ERASING,
+	PROG_NAND_PROGRAMMING,
+};
+
+struct page_buf {
+	u8 *data;		/* NAND_MAX_PAGE_SIZE */
+	u8 *oob;		/* NAND_MAX_OOB_SIZE */
+	struct udc_req *req;
+	u32 page;
+	u8 state;
+};
+
+static struct page_buf page_bufs[NUM_PAGE_BUFS];
+
+static bool nand_ready;
+static u32 nand_failed_page = ~0;
+static u32 nand_corrected;
+
+static struct {
+	struct udc_ep *ep;
+	u32 rx_page;		/* next page to receive */
+	u32 rx_left;		/* pages not yet queued on EP1 */
+	u32 left;		/* pages not yet programmed */
+	unsigned int rx_buf;	/* buffer the next page is received into */
+	unsigned int nand_buf;	/* buffer the next page is programmed from */
+	u8 nand_state;
+	bool reset;		/* a bus reset aborted the transfer */
+} prog;
+
+static struct {
+	struct udc_ep *ep;
+	u32 read_page;		/* next page to read */
+	u32 read_left;		/* pages not yet read */
+	u32 left;		/* pages not yet sent */
+	unsigned int read_buf;	/* buffer the next page is read into */
+	bool reading;
+} dump;
+
+/*
+ * Compressed LOAD receives LZ4 blocks into two staging buffers, one bulk
+ * transfer per block.  A transfer starts with the LZ4 frame format block
+ * size word, bit 31 set for a stored block, and ends in a short packet;
+ * the host appends a pad byte where it would not.  Each block is decoded
+ * straight to the target while EP1 receives the next one into the other
+ * buffer, and the output is summed into the LOAD CRC.  LOAD_LZ4 takes
+ * the same load_data as LOAD, with the decoded length.
+ */
+#define LZ4_STAGE_SIZE		(16 * 1024)
+#define NUM_LZ4_STAGES		2
+#define LZ4_BLOCK_STORED	(1u << 31)
+
+struct lz4_stage {
+	u8 *data;		/* LZ4_STAGE_SIZE */
+	struct udc_req *req;
+	u8 state;
+};
+
+static struct lz4_stage lz4_stages[NUM_LZ4_STAGES];
+
+static struct {
+	struct udc_ep *ep;
+	u8 *base;		/* start of the output */
+	u8 *out;		/* next byte to decode to */
+	u8 *end;		/* end of the output, out == end when idle */
+	unsigned int rx_stage;	/* stage the next block is received into */
+	unsigned int stage;	/* stage the next block is decoded from */
+	bool reset;		/* a bus reset aborted the transfer */
+} lz4;
+
+static inline bool lz4_busy(void)
+{
+	return lz4.out != lz4.end;
+}
+
+/*
+ * Sparse LOAD takes the image as chunks after Android's sparse format, so
+ * only real data crosses the bus.  Chunk headers come in batches, one
+ * short bulk transfer each; a RAW chunk ends its batch and its data is
+ * then received straight into the target.  FILL chunks are expanded
+ * with memset() or a word loop and DONT_CARE chunks leave memory as it
+ * is.  Only the RAW data is summed into the LOAD CRC.  LOAD_SPARSE takes
+ * the same load_data as LOAD, with the expanded length.
+ */
+#define SPARSE_CHUNK_RAW	0xCAC1
+#define SPARSE_CHUNK_FILL	0xCAC2
+#define SPARSE_CHUNK_DONT_CARE	0xCAC3
+
+#define SPARSE_MAX_CHUNKS	42	/* one high speed packet of headers */
+
+struct sparse_chunk {
+	u16 type;
+	u16 reserved;
+	u32 length;		/* bytes of output */
+	u32 fill;		/* FILL pattern, little endian */
+};
+
+enum sparse_state {
+	SPARSE_HEADERS = 0,
+	SPARSE_HEADERS_FULL,
+	SPARSE_RAW,
+	SPARSE_RAW_DONE,
+	SPARSE_ERROR,
+};
+
+#define SPARSE_CHUNKS_SIZE (SPARSE_MAX_CHUNKS * sizeof(struct sparse_chunk))
+
+static struct {
+	struct sparse_chunk *chunks;	/* SPARSE_CHUNKS_SIZE */
+	struct udc_req *req;
+	struct udc_ep *ep;
+	u8 *out;		/* next byte of output */
+	u8 *end;		/* end of the output, out == end when idle */
+	u8 state;
+	bool reset;		/* a bus reset aborted the transfer */
+} sparse;
+
+static inline bool sparse_busy(void)
+{
+	return sparse.out != sparse.end;
+}
+
+/*
+ * Once the host sends BULK with wIndex 1, commands come as frames on EP1
+ * instead of control transfers: a bulk_header, then the payload a control
+ * transfer would have carried, in one transfer.  Every frame is answered
+ * on EP2 by a status frame echoing its tag, with the data an IN control
+ * transfer would have returned, so the host can keep several commands in
+ * flight.  Status frames are queued when a command is accepted, so for
+ * NAND_DUMP the status goes ahead of the pages.  The next frame is read
+ * once the data of the previous command has all been queued on EP1.
+ */
+#define BULK_COMMAND_MAGIC	0x444D4352	/* "RCMD" */
+#define BULK_STATUS_MAGIC	0x53545352	/* "RSTS" */
+#define NUM_BULK_REPLIES	4
+
+enum bulk_status {
+	BULK_STATUS_OK = 0,
+	BULK_STATUS_FAILED,	/* refused, busy or bad payload */
+	BULK_STATUS_BAD_FRAME,
+};
+
+struct bulk_header {
+	u32 magic;
+	u32 tag;
+	u32 length;		/* bytes of payload after the header */
+	u8 command;
+	u8 status;
+	u16 reserved;
+};
+
+/* a header, then up to CMD_BUF_SIZE bytes of payload */
+#define BULK_FRAME_SIZE (sizeof(struct bulk_header) + CMD_BUF_SIZE)
+
+struct bulk_reply {
+	struct bulk_header *hdr;
+	struct udc_req *req;
+	bool busy;
+};
+
+static struct {
+	struct bulk_header *hdr;
+	struct udc_req *req;
+	struct udc_ep *out;
+	struct udc_ep *in;
+	bool enabled;
+	bool armed;		/* req is queued on EP1 */
+	bool pending;		/* a frame waits for a free reply */
+	struct bulk_reply replies[NUM_BULK_REPLIES];
+} bulk;
+
+/*
+ * Every request and buffer the driver transfers with, taken from the UDC
+ * pool and arena once at init; each stays with the owner set up here.
+ */
+static int driver_alloc(void)
+{
+	struct bulk_reply *reply;
+	unsigned int i;
+	bool ok;
+
+	/*
+	 * A failed allocation takes nothing, so one that follows may still
+	 * fit; every result is checked.
+	 */
+	setup_req = udc_req_alloc(NULL);
+	buf = udc_buf_alloc(CMD_BUF_SIZE);
+	ok = setup_req && buf;
+
+	for (i = 0; i < NUM_LOAD_REQS; i++) {
+		load_reqs[i] = udc_req_alloc(NULL);
+		ok = ok && load_reqs[i];
+	}
+
+	for (i = 0; i < NUM_PAGE_BUFS; i++) {
+		page_bufs[i].data = udc_buf_alloc(NAND_MAX_PAGE_SIZE);
+		page_bufs[i].oob = udc_buf_alloc(NAND_MAX_OOB_SIZE);
+		page_bufs[i].req = udc_req_alloc(&page_bufs[i]);
+		ok = ok && page_bufs[i].data && page_bufs[i].oob &&
+				page_bufs[i].req;
+	}
+
+	for (i = 0; i < NUM_LZ4_STAGES; i++) {
+		lz4_stages[i].data = udc_buf_alloc(LZ4_STAGE_SIZE);
+		lz4_stages[i].req = udc_req_alloc(&lz4_stages[i]);
+		ok = ok && lz4_stages[i].data && lz4_stages[i].req;
+	}
+
+	sparse.chunks = udc_buf_alloc(SPARSE_CHUNKS_SIZE);
+	sparse.req = udc_req_alloc(NULL);
+	ok = ok && sparse.chunks && sparse.req;
+
+	bulk.hdr = udc_buf_alloc(BULK_FRAME_SIZE);
+	bulk.req = udc_req_alloc(NULL);
+	ok = ok && bulk.hdr && bulk.req;
+	for (i = 0; i < NUM_BULK_REPLIES; i++) {
+		reply = &bulk.replies[i];
+		reply->hdr = udc_buf_alloc(BULK_FRAME_SIZE);
+		reply->req = udc_req_alloc(reply);
+		reply->busy = false;
+		ok = ok && reply->hdr && reply->req;
+	}
+
+	return ok ? 0 : -ENOMEM;
+}
+
+static void load_queue(struct udc_ep *ep, void *addr, u32 length);
+
+/* work that does not fit in callbacks, run from the main loop */
+static void lz4_task(void);
+static void sparse_task(void);
+static void prog_task(void);
+static void dump_task(void);
+static void run_task(void);
+static void bulk_task(void);
+
+static DEFINE_TASK(lz4_work, lz4_task);
+static DEFINE_TASK(sparse_work, sparse_task);
+static DEFINE_TASK(prog_work, prog_task);
+static DEFINE_TASK(dump_work, dump_task);
+static DEFINE_TASK(run_work, run_task);
+static DEFINE_TASK(bulk_work, bulk_task);
+
+static void load_sg_refill(struct udc_ep *ep)
+{
+	for (; sg_next < sg_count && load_busy < NUM_LOAD_REQS; sg_next++)
+		load_queue(ep, (void *)(unsigned long) sg[sg_next].addr,
+				sg[sg_next].length);
+}
+
+static void load_complete(struct udc_ep *ep, struct udc_req *req)
+{
+	load_length += req->actual;
+	load_busy--;
+
+	/* an aborted request ends the whole segment list */
+	if (req->status)
+		sg_next = sg_count;
+	load_sg_refill(ep);
+
+	/* a slot is free for the next LOAD frame */
+	if (bulk.enabled)
+		task_wake(&bulk_work);
+}
+
+static void load_queue(struct udc_ep *ep, void *addr, u32 length)
+{
+	struct udc_req *req = load_reqs[load_head];
+	u32 flags;
+
+	/* load_complete() may retire another LOAD from the UDC interrupt */
+	flags = irq_save();
+	load_head = (load_head + 1) % NUM_LOAD_REQS;
+	load_busy++;
+	irq_restore(flags);
+
+	udc_req_reset(req);
+	req->buf = addr;
+	req->length = length;
+	req->complete = load_complete;
+	req->crc = &load_crc;
+	ep->ops->queue(ep, req);
+}
+
+static void lz4_received(struct udc_ep *ep, struct udc_req *req)
+{
+	struct lz4_stage *st = req->context;
+
+	/* dequeued by lz4_stop() */
+	if (req->status == -ECONNRESET)
+		return;
+	/*
+	 * The host reset the bus and will not send the rest.  This may run
+	 * from the UDC interrupt in the middle of lz4_task(), so leave the
+	 * stop to the task.
+	 */
+	if (req->status == -ESHUTDOWN)
+		lz4.reset = true;
+
+	if (req->status || req->actual < sizeof(u32))
+		st->state = PAGE_BUF_ERROR;
+	else
+		st->state = PAGE_BUF_FULL;
+	task_wake(&lz4_work);
+}
+
+static void lz4_receive(void)
+{
+	struct lz4_stage *st = &lz4_stages[lz4.rx_stage];
+
+	if (st->state != PAGE_BUF_FREE)
+		return;
+
+	lz4.rx_stage = (lz4.rx_stage + 1) % NUM_LZ4_STAGES;
+	st->state = PAGE_BUF_RECEIVING;
+
+	udc_req_reset(st->req);
+	st->req->buf = st->data;
+	st->req->length = LZ4_STAGE_SIZE;
+	st->req->complete = lz4_received;
+	lz4.ep->ops->queue(lz4.ep, st->req);
+}
+
+static void lz4_start(struct udc_ep *ep, const struct load_data *load)
+{
+	unsigned int i;
+
+	lz4.ep = ep;
+	lz4.base = (u8 *)(unsigned long) load->addr;
+	lz4.out = lz4.base;
+	lz4.end = lz4.base + load->length;
+	lz4.rx_stage = 0;
+	lz4.stage = 0;
+	lz4.reset = false;
+
+	for (i = 0; i < NUM_LZ4_STAGES; i++)
+		lz4_stages[i].state = PAGE_BUF_FREE;
+	lz4_receive();
+	lz4_receive();
+	task_wake(&lz4_work);
+}
+
+/* stop receiving; with @halt the host learns of a bad block by a stall */
+static void lz4_stop(bool halt)
+{
+	unsigned int i;
+
+	lz4.end = lz4.out;
+	task_stop(&lz4_work);
+
+	for (i = 0; i < NUM_LZ4_STAGES; i++) {
+		if (lz4_stages[i].state == PAGE_BUF_RECEIVING)
+			lz4.ep->ops->dequeue(lz4.ep, lz4_stages[i].req);
+		lz4_stages[i].state = PAGE_BUF_FREE;
+	}
+	if (halt)
+		lz4.ep->ops->set_halt(lz4.ep, true);
+}
+
+static void lz4_task(void)
+{
+	struct lz4_stage *st = &lz4_stages[lz4.stage];
+	u32 size;
+	int n;
+
+	if (lz4.reset) {
+		lz4_stop(false);
+		return;
+	}
+	/* lz4_received() wakes us */
+	if (st->state == PAGE_BUF_RECEIVING) {
+		task_stop(&lz4_work);
+		return;
+	}
+	if (st->state != PAGE_BUF_FULL) {
+		lz4_stop(true);
+		return;
+	}
+
+	size = *(u32 *) st->data & ~LZ4_BLOCK_STORED;
+	if (size > st->req->actual - sizeof(u32)) {
+		lz4_stop(true);
+		return;
+	}
+
+	if (*(u32 *) st->data & LZ4_BLOCK_STORED) {
+		n = (size <= (u32) (lz4.end - lz4.out)) ? (int) size : -1;
+		if (n > 0)
+			memcpy(lz4.out, st->data + sizeof(u32), n);
+	} else {
+		n = lz4_decompress(st->data + sizeof(u32), size, lz4.out,
+				lz4.base, lz4.end);
+	}
+	if (n < 0) {
+		lz4_stop(true);
+		return;
+	}
+
+	load_crc = crc32(load_crc, lz4.out, n);
+	load_length += n;
+	lz4.out += n;
+
+	st->state = PAGE_BUF_FREE;
+	lz4.stage = (lz4.stage + 1) % NUM_LZ4_STAGES;
+
+	if (lz4_busy())
+		lz4_receive();
+	else
+		lz4_stop(false);
+}
+
+static void sparse_received(struct udc_ep *ep, struct udc_req *req)
+{
+	/* dequeued by sparse_stop() */
+	if (req->status == -ECONNRESET)
+		return;
+	/* sparse_task() stops without a halt */
+	if (req->status == -ESHUTDOWN)
+		sparse.reset = true;
+
+	if (req->status)
+		sparse.state = SPARSE_ERROR;
+	else if (sparse.state == SPARSE_HEADERS)
+		sparse.state = SPARSE_HEADERS_FULL;
+	else if (req->actual == req->length)
+		sparse.state = SPARSE_RAW_DONE;
+	else
+		sparse.state = SPARSE_ERROR;
+	task_wake(&sparse_work);
+}
+
+static void sparse_queue(u8 state, void *buf, u32 length)
+{
+	struct udc_req *req = sparse.req;
+
+	sparse.state = state;
+	udc_req_reset(req);
+	req->buf = buf;
+	req->length = length;
+	req->complete = sparse_received;
+	if (state == SPARSE_RAW)
+		req->crc = &load_crc;
+	sparse.ep->ops->queue(sparse.ep, req);
+}
+
+static void sparse_start(struct udc_ep *ep, const struct load_data *load)
+{
+	sparse.ep = ep;
+	sparse.out = (u8 *)(unsigned long) load->addr;
+	sparse.end = sparse.out + load->length;
+	sparse.reset = false;
+	sparse_queue(SPARSE_HEADERS, sparse.chunks, SPARSE_CHUNKS_SIZE);
+	task_wake(&sparse_work);
+}
+
+static void sparse_stop(bool halt)
+{
+	task_stop(&sparse_work);
+	if (sparse.state == SPARSE_HEADERS || sparse.state == SPARSE_RAW)
+		sparse.ep->ops->dequeue(sparse.ep, sparse.req);
+	sparse.end = sparse.out;
+	if (halt)
+		sparse.ep->ops->set_halt(sparse.ep, true);
+}
+
+static void sparse_fill(const struct sparse_chunk *chunk)
+{
+	u8 *p = sparse.out, *end = sparse.out + chunk->length;
+	u32 fill = chunk->fill;
+
+	/* 0x00 and 0xFF runs, the usual case, take the fast path */
+	if (fill == (fill & 0xFF) * 0x01010101) {
+		memset(p, fill & 0xFF, chunk->length);
+		return;
+	}
+
+	/* bytes up to a word boundary, then the pattern rotated to match */
+	for (; p < end && ((unsigned long) p & 3); p++) {
+		*p = fill;
+		fill = (fill >> 8) | (fill << 24);
+	}
+	for (; end - p >= 4; p += 4)
+		*(u32 *) p = fill;
+	for (; p < end; p++, fill >>= 8)
+		*p = fill;
+}
+
+/* run a batch of chunk headers, stopping at the RAW chunk that ends it */
+static int sparse_chunks(unsigned int count)
+{
+	const struct sparse_chunk *chunk;
+	unsigned int i;
+
+	for (i = 0; i < count; i++) {
+		chunk = &sparse.chunks[i];
+		if (chunk->length > (u32) (sparse.end - sparse.out))
+			return -1;
+
+		switch (chunk->type) {
+		case SPARSE_CHUNK_RAW:
+			if (i != count - 1 || !chunk->length)
+				return -1;
+			sparse_queue(SPARSE_RAW, sparse.out, chunk->length);
+			return 0;
+
+		case SPARSE_CHUNK_FILL:
+			sparse_fill(chunk);
+			break;
+
+		case SPARSE_CHUNK_DONT_CARE:
+			break;
+
+		default:
+			return -1;
+		}
+		sparse.out += chunk->length;
+	}
+
+	if (sparse_busy())
+		sparse_queue(SPARSE_HEADERS, sparse.chunks,
+				SPARSE_CHUNKS_SIZE);
+	return 0;
+}
+
+static void sparse_task(void)
+{
+	if (sparse.reset) {
+		sparse_stop(false);
+		return;
+	}
+	/* done, or waiting for sparse_received() to wake us */
+	if (!sparse_busy() || sparse.state == SPARSE_HEADERS ||
+			sparse.state == SPARSE_RAW) {
+		task_stop(&sparse_work);
+		return;
+	}
+
+	switch (sparse.state) {
+	case SPARSE_HEADERS_FULL:
+		if (sparse_chunks(sparse.req->actual /
+				sizeof(struct sparse_chunk)))
+			sparse_stop(true);
+		break;
+
+	case SPARSE_RAW_DONE:
+		load_length += sparse.req->actual;
+		sparse.out += sparse.req->actual;
+		if (sparse_busy())
+			sparse_queue(SPARSE_HEADERS, sparse.chunks,
+					SPARSE_CHUNKS_SIZE);
+		break;
+
+	case SPARSE_ERROR:
+		sparse_stop(true);
+		break;
+	}
+}
+
+static void prog_received(struct udc_ep *ep, struct udc_req *req)
+{
+	struct page_buf *pb = req->context;
+
+	/* dequeued by prog_stop() */
+	if (req->status == -ECONNRESET)
+		return;
+	/* prog_task() stops without a halt */
+	if (req->status == -ESHUTDOWN)
+		prog.reset = true;
+
+	if (req->status || req->actual != nand.page_size)
+		pb->state = PAGE_BUF_ERROR;
+	else
+		pb->state = PAGE_BUF_FULL;
+	task_wake(&prog_work);
+}
+
+static void prog_receive(void)
+{
+	struct page_buf *pb = &page_bufs[prog.rx_buf];
+
+	if (!prog.rx_left || pb->state != PAGE_BUF_FREE)
+		return;
+
+	prog.rx_buf = (prog.rx_buf + 1) % NUM_PAGE_BUFS;
+	prog.rx_left--;
+
+	pb->page = prog.rx_page++;
+	pb->state = PAGE_BUF_RECEIVING;
+
+	udc_req_reset(pb->req);
+	pb->req->buf = pb->data;
+	pb->req->length = nand.page_size;
+	pb->req->complete = prog_received;
+	prog.ep->ops->queue(prog.ep, pb->req);
+}
+
+static void prog_encode(struct page_buf *pb)
+{
+	unsigned int sectors = nand.page_size / NAND_SECTOR_SIZE;
+	u8 *ecc = pb->oob + NAND_ECC_OFFSET(nand.oob_size, sectors);
+	unsigned int i;
+
+	memset(pb->oob, 0xFF, nand.oob_size);
+	for (i = 0; i < sectors; i++, ecc += BCH_ECC_BYTES)
+		bch_encode(pb->data + i * NAND_SECTOR_SIZE, NAND_SECTOR_SIZE,
+				ecc);
+	pb->state = PAGE_BUF_READY;
+}
+
+/* stop receiving and let an erase or program already started finish */
+static void prog_stop(void)
+{
+	unsigned int i;
+
+	if (prog.nand_state != PROG_NAND_IDLE)
+		while (nand_busy())
+			;
+
+	prog.rx_left = 0;
+	prog.left = 0;
+	prog.nand_state = PROG_NAND_IDLE;
+	task_stop(&prog_work);
+
+	for (i = 0; i < NUM_PAGE_BUFS; i++) {
+		if (page_bufs[i].state == PAGE_BUF_RECEIVING)
+			prog.ep->ops->dequeue(prog.ep, page_bufs[i].req);
+		page_bufs[i].state = PAGE_BUF_FREE;
+	}
+}
+
+/* the host learns of @page by a stall and NAND_STATUS */
+static void prog_abort(u32 page)
+{
+	prog_stop();
+	nand_failed_page = page;
+	prog.ep->ops->set_halt(prog.ep, true);
+}
+
+static void prog_task(void)
+{
+	struct page_buf *pb;
+	unsigned int i;
+
+	if (prog.reset) {
+		prog_stop();
+		return;
+	}
+	if (!prog.left) {
+		task_stop(&prog_work);
+		return;
+	}
+
+	/* parity for a received page while the chip is busy */
+	for (i = 0; i < NUM_PAGE_BUFS; i++) {
+		if (page_bufs[i].state == PAGE_BUF_ERROR) {
+			prog_abort(page_bufs[i].page);
+			return;
+		}
+		if (page_bufs[i].state == PAGE_BUF_FULL) {
+			prog_encode(&page_bufs[i]);
+			return;
+		}
+	}
+
+	pb = &page_bufs[prog.nand_buf];
+
+	if (prog.nand_state != PROG_NAND_IDLE) {
+		if (nand_busy())
+			return;
+		if (nand_result()) {
+			prog_abort(pb->page);
+			return;
+		}
+		if (prog.nand_state == PROG_NAND_PROGRAMMING) {
+			prog.nand_buf = (prog.nand_buf + 1) % NUM_PAGE_BUFS;
+			prog.left--;
+			pb->state = PAGE_BUF_FREE;
+			prog.nand_state = PROG_NAND_IDLE;
+			prog_receive();
+			return;
+		}
+		/* erase done, program the page that triggered it */
+		nand_program_start(pb->page, pb->data, pb->oob);
+		prog.nand_state = PROG_NAND_PROGRAMMING;
+		return;
+	}
+
+	/* nothing until prog_received() wakes us */
+	if (pb->state != PAGE_BUF_READY) {
+		task_stop(&prog_work);
+		return;
+	}
+
+	if (!(pb->page % nand.pages_per_block)) {
+		/* never erase a factory bad block, the host learns of it */
+		if (nand_block_bad(pb->page)) {
+			prog_abort(pb->page);
+			return;
+		}
+		nand_erase_start(pb->page);
+		prog.nand_state = PROG_NAND_ERASING;
+	} else {
+		nand_program_start(pb->page, pb->data, pb->oob);
+		prog.nand_state = PROG_NAND_PROGRAMMING;
+	}
+}
+
+/*
+ * The host configures the device again after a bus reset, by which time a
+ * transfer it started before will not get the rest of its data.  Not all
+ * of them have a request queued for the endpoint disable to abort, so the
+ * tasks are told to stop without a halt.  This may run from the UDC
+ * interrupt in the middle of a task, which acts on it at its next run.
+ */
+static void drop_transfers(void)
+{
+	if (lz4_busy()) {
+		lz4.reset = true;
+		task_wake(&lz4_work);
+	}
+	if (sparse_busy()) {
+		sparse.reset = true;
+		task_wake(&sparse_work);
+	}
+	if (prog.left) {
+		prog.reset = true;
+		task_wake(&prog_work);
+	}
+}
+
+static void dump_sent(struct udc_ep *ep, struct udc_req *req)
+{
+	struct page_buf *pb = req->context;
+	unsigned int i;
+
+	pb->state = PAGE_BUF_FREE;
+	if (!req->status) {
+		dump.left--;
+		task_wake(&dump_work);
+		return;
+	}
+
+	/* the host went away, drop the rest of the dump */
+	for (i = 0; i < NUM_PAGE_BUFS; i++) {
+		if (page_bufs[i].state == PAGE_BUF_SENDING)
+			dump.ep->ops->dequeue(dump.ep, page_bufs[i].req);
+		page_bufs[i].state = PAGE_BUF_FREE;
+	}
+	dump.read_left = 0;
+	dump.left = 0;
+	task_stop(&dump_work);
+}
+
+static bool sector_erased(const u8 *ecc)
+{
+	unsigned int i;
+
+	for (i = 0; i < BCH_ECC_BYTES; i++)
+		if (ecc[i] != 0xFF)
+			return false;
+	return true;
+}
+
+static void dump_correct(struct page_buf *pb)
+{
+	unsigned int sectors = nand.page_size / NAND_SECTOR_SIZE;
+	const u8 *ecc = pb->oob + NAND_ECC_OFFSET(nand.oob_size, sectors);
+	unsigned int syn[BCH_SYN_WORDS], errloc[BCH_MAX_ERRORS];
+	unsigned int i;
+	u8 *data;
+	int j, n;
+
+	for (i = 0; i < sectors; i++, ecc += BCH_ECC_BYTES) {
+		data = pb->data + i * NAND_SECTOR_SIZE;
+		if (sector_erased(ecc) ||
+				!bch_calculate_syndromes(data, NAND_SECTOR_SIZE,
+					ecc, syn))
+			continue;
+
+		n = bch_decode(NAND_SECTOR_SIZE, syn, errloc);
+		if (n < 0) {
+			if (nand_failed_page == ~0u)
+				nand_failed_page = pb->page;
+			continue;
+		}
+		for (j = 0; j < n; j++)
+			if (errloc[j] < 8 * NAND_SECTOR_SIZE)
+				data[errloc[j] / 8] ^= 1 << (errloc[j] % 8);
+		nand_corrected += n;
+	}
+}
+
+static void dump_task(void)
+{
+	struct page_buf *pb = &page_bufs[dump.read_buf];
+	unsigned int i;
+
+	if (!dump.left) {
+		task_stop(&dump_work);
+		return;
+	}
+
+	if (dump.reading) {
+		if (nand_busy())
+			return;
+		nand_read_page(pb->data, pb->oob);
+		pb->state = PAGE_BUF_FULL;
+		dump.read_buf = (dump.read_buf + 1) % NUM_PAGE_BUFS;
+		dump.reading = false;
+		return;
+	}
+
+	/* start the next read before correcting, so they overlap */
+	if (dump.read_left && pb->state == PAGE_BUF_FREE) {
+		pb->page = dump.read_page++;
+		dump.read_left--;
+		nand_read_start(pb->page);
+		dump.reading = true;
+	}
+
+	for (i = 0; i < NUM_PAGE_BUFS; i++) {
+		pb = &page_bufs[i];
+		if (pb->state != PAGE_BUF_FULL)
+			continue;
+
+		dump_correct(pb);
+		pb->state = PAGE_BUF_SENDING;
+		udc_req_reset(pb->req);
+		pb->req->buf = pb->data;
+		pb->req->length = nand.page_size;
+		pb->req->complete = dump_sent;
+		dump.ep->ops->queue(dump.ep, pb->req);
+		return;
+	}
+
+	/* all buffers are on their way to the host, dump_sent() wakes us */
+	if (!dump.reading)
+		task_stop(&dump_work);
+}
+
+/* RUN jumps from the main loop, never from inside udc_task() */
+static u32 run_addr;
+
+static void run_task(void)
+{
+	void (*f)(void) = (void (*)(void))(unsigned long) run_addr;
+
+	task_stop(&run_work);
+#ifdef CONFIG_INTERRUPTS
+	irq_exit();
+#endif
+	/* the image must be in SDRAM, not only in the D-cache */
+	mmu_exit();
+	disable_cache();
+	f();
+}
+
+/* a transfer of any kind is in progress */
+static bool driver_busy(void)
+{
+	return load_busy || sg_next < sg_count || lz4_busy() ||
+			sparse_busy() || prog.left || dump.left;
+}
+
+static int nand_setup(void)
+{
+	if (driver_busy())
+		return -1;
+	if (!nand_ready) {
+		if (nand_init())
+			return -1;
+		nand_ready = true;
+	}
+	return 0;
+}
+
+/* whether an OUT command can be accepted now */
+static int command_check(u16 cmd)
+{
+	switch (cmd) {
+	case COMMAND_LOAD:
+		if (load_busy == NUM_LOAD_REQS || sg_next < sg_count ||
+				lz4_busy() || sparse_busy() || prog.left)
+			return -1;
+		return 0;
+
+	case COMMAND_RUN:
+		return 0;
+
+	case COMMAND_LOAD_LZ4:
+	case COMMAND_LOAD_SPARSE:
+	case COMMAND_LOAD_SG:
+		return driver_busy() ? -1 : 0;
+
+	case COMMAND_NAND_PROGRAM:
+	case COMMAND_NAND_DUMP:
+		return nand_setup();
+	}
+	return -1;
+}
+
+/* run an OUT command with its payload, -1 if the payload is malformed */
+static int command_run(struct udc *udc, u16 cmd, void *data, u32 len)
 {
-	struct udc *udc = ep->dev;
 	struct udc_ep *ep1 = &udc->ep[1];
+	struct load_data *load = data;
+	struct nand_data *nd = data;
+	unsigned int i;
 
 	switch (cmd) {
 	case COMMAND_LOAD:
-		if (req->actual != sizeof(struct load_data))
-			return;
+		if (len != sizeof(struct load_data))
+			return -1;
+
+		load_queue(ep1, (void *)(unsigned long) load->addr,
+				load->length);
+		break;
+
+	case COMMAND_LOAD_LZ4:
+		/* nothing would dequeue the stages of an empty load */
+		if (len != sizeof(struct load_data) || !load->length)
+			return -1;
+
+		lz4_start(ep1, data);
+		break;
+
+	case COMMAND_LOAD_SPARSE:
+		/* an empty load would leave its headers request queued */
+		if (len != sizeof(struct load_data) || !load->length)
+			return -1;
+
+		sparse_start(ep1, data);
+		break;
+
+	case COMMAND_LOAD_SG:
+		if (!len || len > sizeof(sg) || len % sizeof(struct load_data))
+			return -1;
 
-		struct load_data *load = req->buf;
+		struct load_data *seg = data;
 
-		bzero(&buffer_req, sizeof(buffer_req));
-		INIT_LIST_HEAD(&buffer_req.queue);
-		buffer_req.buf = load->addr;
-		buffer_req.length = load->length;
-		ep1->ops->queue(ep1, &buffer_req);
+		/* empty segments would wait for a packet that never comes */
+		sg_next = 0;
+		sg_count = 0;
+		for (i = 0; i < len / sizeof(*seg); i++)
+			if (seg[i].length)
+				sg[sg_count++] = seg[i];
+		load_sg_refill(ep1);
 		break;
 
 	case COMMAND_RUN:
-		if (req->actual != sizeof(struct run_data))
-			return;
+		if (len != sizeof(struct run_data))
+			return -1;
+
+		struct run_data *run = data;
+		run_addr = run->addr;
+		task_wake(&run_work);
+		break;
+
+	case COMMAND_NAND_PROGRAM:
+	case COMMAND_NAND_DUMP:
+		if (len != sizeof(struct nand_data))
+			return -1;
+
+		nand_failed_page = ~0;
+		nand_corrected = 0;
+		for (i = 0; i < NUM_PAGE_BUFS; i++)
+			page_bufs[i].state = PAGE_BUF_FREE;
+
+		if (cmd == COMMAND_NAND_DUMP) {
+			dump.ep = &udc->ep[2];
+			dump.read_page = nd->page;
+			dump.read_left = nd->count;
+			dump.left = nd->count;
+			dump.read_buf = 0;
+			dump.reading = false;
+			task_wake(&dump_work);
+			break;
+		}
+
+		/* blocks are erased as programming enters them */
+		if (nd->page % nand.pages_per_block) {
+			nand_failed_page = nd->page;
+			ep1->ops->set_halt(ep1, true);
+			return -1;
+		}
 
-		struct run_data *run = req->buf;
-		disable_cache();
-		run->f();
+		prog.ep = ep1;
+		prog.rx_page = nd->page;
+		prog.rx_left = nd->count;
+		prog.left = nd->count;
+		prog.nand_state = PROG_NAND_IDLE;
+		prog.reset = false;
+		prog.rx_buf = 0;
+		prog.nand_buf = 0;
+		prog_receive();
+		prog_receive();
+		task_wake(&prog_work);
 		break;
+
+	default:
+		return -1;
+	}
+	return 0;
+}
+
+static void command_data(struct udc_ep *ep, struct udc_req *req)
+{
+	command_run(ep->dev, cmd, req->buf, req->actual);
+}
+
+/*
+ * Build the reply to an IN command in @out, or point @data at it when it
+ * lives elsewhere.  Returns its size, or -1 for commands without one.
+ */
+static int command_reply(u16 cmd, void *out, void **data)
+{
+	struct nand_status_data *status = out;
+	struct load_crc_data *crc = out;
+	u32 flags;
+
+	*data = out;
+
+	switch (cmd) {
+	case COMMAND_LOAD_CRC:
+		/*
+		 * Covers all LOAD data since the last read that found nothing
+		 * pending; while LOADs are still queued the host reads again.
+		 * The FIFO drain sums into load_crc from the UDC interrupt.
+		 */
+		flags = irq_save();
+		crc->crc = load_crc;
+		crc->length = load_length;
+		crc->pending = load_busy + (sg_count - sg_next) + lz4_busy() +
+				sparse_busy();
+		if (!crc->pending) {
+			load_crc = 0;
+			load_length = 0;
+		}
+		irq_restore(flags);
+		return sizeof(*crc);
+
+	case COMMAND_NAND_STATUS:
+		status->remaining = prog.left + dump.left;
+		status->failed_page = nand_failed_page;
+		status->corrected = nand_corrected;
+		return sizeof(*status);
+
+#ifdef CONFIG_STATS
+	case COMMAND_STATS:
+		*data = stats_snapshot();
+		return sizeof(struct stats);
+#endif
+	}
+	return -1;
+}
+
+static int command_in(struct udc_ep *ep0, struct usb_ctrlrequest *ctrl)
+{
+	void *data;
+	int size;
+
+	size = command_reply(cmd, buf, &data);
+	if (size < 0)
+		return -1;
+
+	udc_req_reset(setup_req);
+	setup_req->buf = data;
+	setup_req->length = min((u32)ctrl->wLength, (u32)size);
+	ep0->ops->queue(ep0, setup_req);
+	return 0;
+}
+
+static void bulk_received(struct udc_ep *ep, struct udc_req *req)
+{
+	bulk.armed = false;
+
+	/* dequeued, or the endpoint went away with a reset */
+	if (req->status) {
+		bulk.enabled = false;
+		return;
+	}
+	bulk.pending = true;
+	task_wake(&bulk_work);
+}
+
+static void bulk_receive(void)
+{
+	struct udc_req *req = bulk.req;
+
+	udc_req_reset(req);
+	req->buf = bulk.hdr;
+	req->length = BULK_FRAME_SIZE;
+	req->complete = bulk_received;
+	bulk.armed = true;
+	bulk.out->ops->queue(bulk.out, req);
+}
+
+static void bulk_sent(struct udc_ep *ep, struct udc_req *req)
+{
+	struct bulk_reply *reply = req->context;
+
+	reply->busy = false;
+	if (bulk.enabled)
+		task_wake(&bulk_work);
+}
+
+static struct bulk_reply *bulk_reply_get(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < NUM_BULK_REPLIES; i++)
+		if (!bulk.replies[i].busy)
+			return &bulk.replies[i];
+	return NULL;
+}
+
+/* run the received frame and queue its status */
+static void bulk_command(struct bulk_reply *reply)
+{
+	struct bulk_header *hdr = bulk.hdr, *status = reply->hdr;
+	u32 len = bulk.req->actual - sizeof(*hdr);
+	void *out = status + 1;
+	void *data = out;
+	int size = 0;
+
+	status->magic = BULK_STATUS_MAGIC;
+	status->tag = hdr->tag;
+	status->command = hdr->command;
+	status->reserved = 0;
+
+	/* the host may append a pad byte to end the transfer short */
+	if (bulk.req->actual < sizeof(*hdr) ||
+			hdr->magic != BULK_COMMAND_MAGIC || hdr->length > len) {
+		status->status = BULK_STATUS_BAD_FRAME;
+	} else if (!command_check(hdr->command)) {
+		if (command_run(bulk.out->dev, hdr->command, hdr + 1,
+				hdr->length))
+			status->status = BULK_STATUS_FAILED;
+		else
+			status->status = BULK_STATUS_OK;
+	} else if (!hdr->length && (size = command_reply(hdr->command,
+			out, &data)) >= 0) {
+		if (data != out)
+			memcpy(out, data, size);
+		status->status = BULK_STATUS_OK;
+	} else {
+		size = 0;
+		status->status = BULK_STATUS_FAILED;
 	}
+	status->length = size;
+
+	reply->busy = true;
+	udc_req_reset(reply->req);
+	reply->req->buf = status;
+	reply->req->length = sizeof(*status) + size;
+	reply->req->zero = 1;
+	reply->req->complete = bulk_sent;
+	bulk.in->ops->queue(bulk.in, reply->req);
+}
+
+/*
+ * Frames share EP1 with the data of the commands they carry, so the next
+ * one is only read once that data is all queued ahead of it.  LOADs and
+ * replies wake us as they retire; the longer streams are polled.
+ */
+static bool bulk_ready(void)
+{
+	return load_busy < NUM_LOAD_REQS && sg_next == sg_count &&
+			!lz4_busy() && !sparse_busy() && !prog.rx_left &&
+			!dump.left;
+}
+
+static void bulk_task(void)
+{
+	struct bulk_reply *reply;
+
+	if (!bulk.enabled || bulk.armed) {
+		task_stop(&bulk_work);
+		return;
+	}
+
+	if (bulk.pending) {
+		/* bulk_sent() wakes us */
+		reply = bulk_reply_get();
+		if (!reply) {
+			task_stop(&bulk_work);
+			return;
+		}
+		bulk.pending = false;
+		bulk_command(reply);
+	}
+
+	if (!bulk_ready()) {
+		task_sleep(&bulk_work, 1);
+		return;
+	}
+	/* a frame already waiting completes at once and wakes us */
+	task_stop(&bulk_work);
+	bulk_receive();
+}
+
+static int bulk_enable(struct udc *udc, bool on)
+{
+	if (on == bulk.enabled)
+		return 0;
+
+	if (!on) {
+		bulk.enabled = false;
+		bulk.pending = false;
+		task_stop(&bulk_work);
+		if (bulk.armed)
+			bulk.out->ops->dequeue(bulk.out, bulk.req);
+		return 0;
+	}
+
+	if (!udc->config || driver_busy())
+		return -1;
+
+	bulk.out = &udc->ep[1];
+	bulk.in = &udc->ep[2];
+	bulk.enabled = true;
+	task_wake(&bulk_work);
+	return 0;
 }
 
 static int command_handler(struct udc *udc, struct usb_ctrlrequest *ctrl)
@@ -260,22 +1563,30 @@ static int command_handler(struct udc *udc, struct usb_ctrlrequest *ctrl)
 
 	if (!(ctrl->bRequestType & USB_DIR_IN)) {
 		if (ctrl->wLength > 0) {
-			bzero(&setup_req, sizeof(setup_req));
-			INIT_LIST_HEAD(&setup_req.queue);
-			setup_req.buf = buf;
-			setup_req.length = min((u32)ctrl->wLength, sizeof(buf));
-			setup_req.complete = command_data;
-			switch (cmd) {
-			case COMMAND_LOAD:
-			case COMMAND_RUN:
-				ep0->ops->queue(ep0, &setup_req);
-				return 0;
-			}
+			/* EP1 carries the command frames instead */
+			if (bulk.enabled || command_check(cmd))
+				return -1;
 
+			udc_req_reset(setup_req);
+			setup_req->buf = buf;
+			setup_req->length = min((u32)ctrl->wLength,
+					(u32)CMD_BUF_SIZE);
+			setup_req->complete = command_data;
+			ep0->ops->queue(ep0, setup_req);
+			return 0;
+		} else if (cmd == COMMAND_BULK) {
+			/* no data stage, wIndex turns the frames on or off */
+			return bulk_enable(udc, ctrl->wIndex);
 		}
-		else {
-			/* nothing */
+#ifdef CONFIG_STATS
+		else if (cmd == COMMAND_STATS) {
+			/* no data stage, clears the counters */
+			stats_reset();
+			return 0;
 		}
+#endif
+	} else if (ctrl->wLength > 0) {
+		return command_in(ep0, ctrl);
 	}
 	return -1;
 }
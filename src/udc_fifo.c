@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "asm/io.h"
+#include "asm/types.h"
+
+#include "crc32.h"
+#include "udc_fifo.h"
+
+/*
+ * FIFO copy kernels.  The data registers are 16 bits wide, so the MMIO side
+ * is always halfword accesses; the memory side is moved a word at a time
+ * with the loop unrolled to four words so the compiler can use ldm/stm.
+ * Any buffer alignment is handled by merging halfwords in registers, never
+ * by falling back to byte-sized FIFO accesses.
+ */
+void udc_fifo_read(void __iomem *fifo, u8 *dst, unsigned int len)
+{
+	u32 *p, w0, w1, w2, w3, carry;
+
+	if (!((unsigned long) dst & 1)) {
+		if (((unsigned long) dst & 2) && len >= 2) {
+			*(u16 *) dst = readw(fifo);
+			dst += 2;
+			len -= 2;
+		}
+
+		p = (u32 *) dst;
+		for (; len >= 16; len -= 16) {
+			w0 = readw(fifo);
+			w0 |= readw(fifo) << 16;
+			w1 = readw(fifo);
+			w1 |= readw(fifo) << 16;
+			w2 = readw(fifo);
+			w2 |= readw(fifo) << 16;
+			w3 = readw(fifo);
+			w3 |= readw(fifo) << 16;
+			p[0] = w0;
+			p[1] = w1;
+			p[2] = w2;
+			p[3] = w3;
+			p += 4;
+		}
+		for (; len >= 4; len -= 4) {
+			w0 = readw(fifo);
+			*p++ = w0 | (readw(fifo) << 16);
+		}
+
+		dst = (u8 *) p;
+		if (len >= 2) {
+			*(u16 *) dst = readw(fifo);
+			dst += 2;
+			len -= 2;
+		}
+		if (len)
+			*dst = readw(fifo);
+		return;
+	}
+
+	if (!len)
+		return;
+
+	/* odd destination: every store straddles two FIFO halfwords */
+	w0 = readw(fifo);
+	*dst++ = w0;
+	carry = w0 >> 8;
+	len--;
+
+	if (((unsigned long) dst & 2) && len >= 3) {
+		w0 = readw(fifo);
+		*(u16 *) dst = carry | (w0 << 8);
+		carry = w0 >> 8;
+		dst += 2;
+		len -= 2;
+	}
+
+	p = (u32 *) dst;
+	for (; len >= 5; len -= 4) {
+		w0 = readw(fifo);
+		w1 = readw(fifo);
+		*p++ = carry | (w0 << 8) | (w1 << 24);
+		carry = w1 >> 8;
+	}
+
+	dst = (u8 *) p;
+	for (; len >= 3; len -= 2) {
+		w0 = readw(fifo);
+		*dst++ = carry;
+		*dst++ = w0;
+		carry = w0 >> 8;
+	}
+	if (len == 2) {
+		w0 = readw(fifo);
+		*dst++ = carry;
+		*dst = w0;
+	} else if (len) {
+		*dst = carry;
+	}
+}
+
+/**
+ * udc_fifo_read_crc - udc_fifo_read() that also updates a CRC-32
+ * @fifo:     FIFO data register
+ * @dst:      destination buffer
+ * @len:      bytes to read
+ * @crc:      running crc32() value, updated in place
+ *
+ * For an even @dst each word is summed while it is still in a register,
+ * between the FIFO reads, instead of in a second pass over the packet in
+ * memory.  An odd @dst and the tail take the two-pass way.
+ */
+void udc_fifo_read_crc(void __iomem *fifo, u8 *dst, unsigned int len,
+		u32 *crc)
+{
+	u32 *p, w0, w1, w2, w3, c;
+
+	if ((unsigned long) dst & 1) {
+		udc_fifo_read(fifo, dst, len);
+		*crc = crc32(*crc, dst, len);
+		return;
+	}
+
+	if (((unsigned long) dst & 2) && len >= 2) {
+		*(u16 *) dst = readw(fifo);
+		*crc = crc32(*crc, dst, 2);
+		dst += 2;
+		len -= 2;
+	}
+
+	p = (u32 *) dst;
+
+	c = ~*crc;
+	for (; len >= 16; len -= 16) {
+		w0 = readw(fifo);
+		w0 |= readw(fifo) << 16;
+		w1 = readw(fifo);
+		w1 |= readw(fifo) << 16;
+		w2 = readw(fifo);
+		w2 |= readw(fifo) << 16;
+		w3 = readw(fifo);
+		w3 |= readw(fifo) << 16;
+		p[0] = w0;
+		p[1] = w1;
+		p[2] = w2;
+		p[3] = w3;
+		p += 4;
+		c = crc32_word(c, w0);
+		c = crc32_word(c, w1);
+		c = crc32_word(c, w2);
+		c = crc32_word(c, w3);
+	}
+	for (; len >= 4; len -= 4) {
+		w0 = readw(fifo);
+		w0 |= readw(fifo) << 16;
+		*p++ = w0;
+		c = crc32_word(c, w0);
+	}
+	*crc = ~c;
+
+	if (len) {
+		udc_fifo_read(fifo, (u8 *) p, len);
+		*crc = crc32(*crc, p, len);
+	}
+}
+
+void udc_fifo_write(void __iomem *fifo, const u8 *src,
+		unsigned int len)
+{
+	const u32 *p;
+	u32 w0, w1, w2, w3;
+
+	if ((unsigned long) src & 1) {
+		for (; len >= 2; len -= 2, src += 2)
+			writew(src[0] | (src[1] << 8), fifo);
+		if (len)
+			writew(*src, fifo);
+		return;
+	}
+
+	if (((unsigned long) src & 2) && len >= 2) {
+		writew(*(const u16 *) src, fifo);
+		src += 2;
+		len -= 2;
+	}
+
+	p = (const u32 *) src;
+	for (; len >= 16; len -= 16) {
+		w0 = p[0];
+		w1 = p[1];
+		w2 = p[2];
+		w3 = p[3];
+		p += 4;
+		writew(w0, fifo);
+		writew(w0 >> 16, fifo);
+		writew(w1, fifo);
+		writew(w1 >> 16, fifo);
+		writew(w2, fifo);
+		writew(w2 >> 16, fifo);
+		writew(w3, fifo);
+		writew(w3 >> 16, fifo);
+	}
+	for (; len >= 4; len -= 4) {
+		w0 = *p++;
+		writew(w0, fifo);
+		writew(w0 >> 16, fifo);
+	}
+
+	src = (const u8 *) p;
+	if (len >= 2) {
+		writew(*(const u16 *) src, fifo);
+		src += 2;
+		len -= 2;
+	}
+	if (len)
+		writew(*src, fifo);
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _UDC_FIFO_H
+#define _UDC_FIFO_H
+
+#include "asm/io.h"
+#include "asm/types.h"
+
+void udc_fifo_read(void __iomem *fifo, u8 *dst, unsigned int len);
+void udc_fifo_read_crc(void __iomem *fifo, u8 *dst, unsigned int len,
+		u32 *crc);
+void udc_fifo_write(void __iomem *fifo, const u8 *src, unsigned int len);
+
+#endif /* _UDC_FIFO_H */
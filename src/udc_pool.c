@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "asm/types.h"
+#include "baremetal/util.h"
+#include "linux/list.h"
+
+#include "udc.h"
+#include "udc_pool.h"
+
+/*
+ * Every request the UDC stack queues comes from one fixed pool, and every
+ * buffer it transfers to or from is carved out of one arena.  Both are
+ * handed out once, by udc_init() and the gadget driver's init, and stay
+ * with their owner until the next udc_init() takes them all back, so
+ * nothing is allocated while transfers run.  Arena buffers start on a
+ * cache line and are padded to whole lines.
+ */
+static struct udc_req reqs[NUM_UDC_REQS];
+static struct list_head free_reqs;
+
+static u8 arena[UDC_ARENA_SIZE] __attribute__((aligned(UDC_BUF_ALIGN)));
+static unsigned int arena_used;
+
+void udc_pool_init(void)
+{
+	unsigned int i;
+
+	INIT_LIST_HEAD(&free_reqs);
+	for (i = 0; i < NUM_UDC_REQS; i++)
+		list_add_tail(&reqs[i].queue, &free_reqs);
+	arena_used = 0;
+}
+
+/**
+ * udc_req_alloc - take a request from the pool
+ * @context:  owner, handed back in req->context by completion callbacks
+ *
+ * Returns:
+ *  a cleared request, or NULL once the pool is empty
+ */
+struct udc_req *udc_req_alloc(void *context)
+{
+	struct udc_req *req;
+
+	if (list_empty(&free_reqs))
+		return NULL;
+
+	req = list_first_entry(&free_reqs, struct udc_req, queue);
+	list_del_init(&req->queue);
+	bzero(req, sizeof(*req));
+	INIT_LIST_HEAD(&req->queue);
+	req->context = context;
+	return req;
+}
+
+/**
+ * udc_buf_alloc - carve a transfer buffer out of the arena
+ * @size:     bytes, rounded up to whole cache lines
+ *
+ * Returns:
+ *  a UDC_BUF_ALIGN aligned buffer, or NULL if the arena is used up
+ */
+void *udc_buf_alloc(unsigned int size)
+{
+	void *buf;
+
+	size = (size + UDC_BUF_ALIGN - 1) & ~(UDC_BUF_ALIGN - 1);
+	if (size > UDC_ARENA_SIZE - arena_used)
+		return NULL;
+
+	buf = arena + arena_used;
+	arena_used += size;
+	return buf;
+}
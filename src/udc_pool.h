@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2013 Jeff Kent <jeff@jkent.net>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _UDC_POOL_H
+#define _UDC_POOL_H
+
+#include <string.h>
+
+#include "baremetal/util.h"
+#include "linux/list.h"
+
+#include "udc.h"
+
+/* ARM926EJ-S D-cache line, so DMA never shares a line with the CPU */
+#define UDC_BUF_ALIGN		32
+
+#define NUM_UDC_REQS		20
+#define UDC_ARENA_SIZE		(48 * 1024)
+
+void udc_pool_init(void);
+struct udc_req *udc_req_alloc(void *context);
+void *udc_buf_alloc(unsigned int size);
+
+/* clear a request for its next transfer, keeping its owner */
+static inline void udc_req_reset(struct udc_req *req)
+{
+	void *context = req->context;
+
+	bzero(req, sizeof(*req));
+	INIT_LIST_HEAD(&req->queue);
+	req->context = context;
+}
+
+#endif /* _UDC_POOL_H */
@@ -0,0 +1,130 @@
+#!/usr/bin/env python
+# vim: ai ts=4 sts=4 et sw=4
+#
+# Generate the GF(2^m) antilog/log tables, the degree 2 root basis and the
+# encoder remainder tables used by src/bch.c, so they can live in .rodata
+# instead of being built at boot.
+#
+#   python tools/bch_tables.py > src/bch_tables.c
+
+import sys
+
+def deg(poly):
+    return poly.bit_length() - 1
+
+def build(m, poly):
+    n = (1 << m) - 1
+    pow_tab = [0] * (n + 1)
+    log_tab = [0] * (n + 1)
+    x = 1
+    for i in range(n):
+        pow_tab[i] = x
+        log_tab[x] = i
+        x <<= 1
+        if x & (1 << deg(poly)):
+            x ^= poly
+    pow_tab[n] = 1
+    log_tab[0] = 0
+
+    def a_pow(i):
+        return pow_tab[i % n]
+
+    def gf_sqr(a):
+        return a_pow(2 * log_tab[a]) if a else 0
+
+    # find k s.t. Tr(a^k) = 1 and 0 <= k < m
+    ak = 0
+    for i in range(m):
+        s = 0
+        for j in range(m):
+            s ^= a_pow(i * (1 << j))
+        if s:
+            ak = pow_tab[i]
+            break
+
+    # xi_tab[i] solves x^2+x = a^i+Tr(a^i).a^k
+    xi_tab = [None] * m
+    remaining = m
+    x = 0
+    while x <= n and remaining:
+        y = gf_sqr(x) ^ x
+        for i in range(2):
+            r = log_tab[y]
+            if y and r < m and xi_tab[r] is None:
+                xi_tab[r] = x
+                remaining -= 1
+                break
+            y ^= ak
+        x += 1
+
+    return pow_tab, log_tab, xi_tab
+
+def gf_mul(pow_tab, log_tab, n, a, b):
+    return pow_tab[(log_tab[a] + log_tab[b]) % n] if a and b else 0
+
+def build_enc(m, t, pow_tab, log_tab):
+    n = (1 << m) - 1
+    # generator: product of the minimal polynomials of a^1, a^3, ..., a^(2t-1)
+    g = [1]
+    for i in range(1, 2 * t, 2):
+        for r in range(m):
+            root = pow_tab[(i << r) % n]
+            p = [0] * (len(g) + 1)
+            for j, c in enumerate(g):
+                p[j + 1] ^= c
+                p[j] ^= gf_mul(pow_tab, log_tab, n, c, root)
+            g = p
+    gen = 0
+    for i, c in enumerate(g):
+        assert c in (0, 1)
+        gen |= c << i
+
+    # enc_tab[k][b] = b(x).x^(8k).x^(m*t) mod g(x), left-aligned in 64 bits
+    shift = 64 - m * t
+    gl = (gen << shift) & ((1 << 64) - 1)
+    tabs = [[0] * 256 for k in range(4)]
+    for b in range(256):
+        rem = b << 56
+        for k in range(4):
+            for i in range(8):
+                top = rem >> 63
+                rem = (rem << 1) & ((1 << 64) - 1)
+                if top:
+                    rem ^= gl
+            tabs[k][b] = rem
+    return tabs
+
+def emit(out, ctype, name, values, per_line=8):
+    out.write('const %s %s[%d] = {\n' % (ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        line = ', '.join('0x%04x' % v for v in values[i:i + per_line])
+        out.write('\t%s,\n' % line)
+    out.write('};\n\n')
+
+def emit_enc(out, name, tabs, per_line=3):
+    out.write('const uint64_t %s[%d][256] = {\n' % (name, len(tabs)))
+    for tab in tabs:
+        out.write('\t{\n')
+        for i in range(0, len(tab), per_line):
+            line = ', '.join('0x%016xULL' % v for v in tab[i:i + per_line])
+            out.write('\t\t%s,\n' % line)
+        out.write('\t},\n')
+    out.write('};\n')
+
+def main():
+    m, t, poly = 13, 4, 0x25AF
+    pow_tab, log_tab, xi_tab = build(m, poly)
+    enc_tab = build_enc(m, t, pow_tab, log_tab)
+
+    out = sys.stdout
+    out.write('/*\n * GF(2^%d) tables for polynomial 0x%X\n *\n'
+              ' * Generated by tools/bch_tables.py, do not edit.\n */\n\n'
+              % (m, poly))
+    out.write('#include <stdint.h>\n\n#include "bch_tables.h"\n\n')
+    emit(out, 'uint16_t', 'bch_a_pow_tab', pow_tab)
+    emit(out, 'uint16_t', 'bch_a_log_tab', log_tab)
+    emit(out, 'unsigned int', 'bch_xi_tab', xi_tab)
+    emit_enc(out, 'bch_enc_tab', enc_tab)
+
+if __name__ == '__main__':
+    main()